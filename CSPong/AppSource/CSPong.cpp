@@ -28,7 +28,9 @@
 
 #include <CSPong.h>
 
+#include <Server/MatchServerState.h>
 #include <Splash/SplashState.h>
+#include <Stress/StressState.h>
 
 #include <ChilliSource/Input/Accelerometer.h>
 #include <ChilliSource/Rendering/Model.h>
@@ -177,7 +179,15 @@ namespace CSPong
          Next: 'State Lifecycles' in SplashState.cpp
          */
         
+#ifdef CSPONG_DEDICATED_SERVER
+        //The dedicated server build skips the front end and hosts headless matches instead.
+        GetStateManager()->Push(CS::StateSPtr(new MatchServerState()));
+#elif defined(CSPONG_STRESS_BENCHMARK)
+        //The benchmark build skips the front end and runs the headless multi-ball stress test.
+        GetStateManager()->Push(CS::StateSPtr(new StressState(StressState::Mode::k_headless)));
+#else
         GetStateManager()->Push(CS::StateSPtr(new SplashState()));
+#endif
     }
     //---------------------------------------------------------
     //---------------------------------------------------------
@@ -0,0 +1,51 @@
+//
+//  Easing.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Easing.h>
+
+namespace CSPong
+{
+    namespace Easing
+    {
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        f32 SmoothStep(f32 in_t)
+        {
+            return in_t * in_t * (3.0f - 2.0f * in_t);
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        f32 EaseOutBack(f32 in_t)
+        {
+            const f32 k_overshoot = 1.70158f;
+            
+            f32 t = in_t - 1.0f;
+            return t * t * ((k_overshoot + 1.0f) * t + k_overshoot) + 1.0f;
+        }
+    }
+}
@@ -0,0 +1,58 @@
+//
+//  Easing.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_EASING_H_
+#define _APPSOURCE_COMMON_EASING_H_
+
+#include <ForwardDeclarations.h>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// Easing functions for the TweenSystem. Each maps normalised
+    /// time in [0, 1] to normalised progress and matches the
+    /// engine tween of the same name.
+    //------------------------------------------------------------
+    namespace Easing
+    {
+        //------------------------------------------------------------
+        /// @param Normalised time.
+        ///
+        /// @return Progress, easing in and out.
+        //------------------------------------------------------------
+        f32 SmoothStep(f32 in_t);
+        //------------------------------------------------------------
+        /// @param Normalised time.
+        ///
+        /// @return Progress, overshooting past 1 before settling.
+        //------------------------------------------------------------
+        f32 EaseOutBack(f32 in_t);
+    }
+}
+
+#endif
@@ -28,6 +28,9 @@
 
 #include <Common/TransitionSystem.h>
 
+#include <Common/Easing.h>
+#include <Common/TweenSystem.h>
+
 #include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Math.h>
 #include <ChilliSource/Core/Resource.h>
@@ -42,14 +45,14 @@ namespace CSPong
     CS_DEFINE_NAMEDTYPE(TransitionSystem);
     //-------------------------------------------------
     //-------------------------------------------------
-    TransitionSystemUPtr TransitionSystem::Create(f32 in_fadeInTime, f32 in_fadeOutTime)
+    TransitionSystemUPtr TransitionSystem::Create(TweenSystem* in_tweenSystem, f32 in_fadeInTime, f32 in_fadeOutTime)
     {
-        return TransitionSystemUPtr(new TransitionSystem(in_fadeInTime, in_fadeOutTime));
+        return TransitionSystemUPtr(new TransitionSystem(in_tweenSystem, in_fadeInTime, in_fadeOutTime));
     }
     //-------------------------------------------------
     //-------------------------------------------------
-    TransitionSystem::TransitionSystem(f32 in_fadeInTime, f32 in_fadeOutTime)
-    : m_transitionState(TransitionState::k_in), m_fadeInTime(in_fadeInTime), m_fadeOutTime(in_fadeOutTime)
+    TransitionSystem::TransitionSystem(TweenSystem* in_tweenSystem, f32 in_fadeInTime, f32 in_fadeOutTime)
+    : m_transitionState(TransitionState::k_in), m_fadeInTime(in_fadeInTime), m_fadeOutTime(in_fadeOutTime), m_tweenSystem(in_tweenSystem)
     {
     }
     //-------------------------------------------------
@@ -69,12 +72,11 @@ namespace CSPong
             GetState()->GetUICanvas()->AddWidget(m_fadeImageView);
             m_fadeImageView->BringToFront();
             
-            m_fadeTween = CS::MakeSmoothStepTween<f32>(0.0f, 1.0f, m_fadeOutTime);
-            m_fadeTween.SetOnEndDelegate([=](CS::SmoothStepTween<f32>* in_tween)
-                                         {
-                                             CS::Application::Get()->GetStateManager()->Change(m_targetState);
-                                         });
-            m_fadeTween.Play(CS::TweenPlayMode::k_once);
+            m_tweenSystem->Stop(m_fadeTween);
+            m_fadeTween = m_tweenSystem->Play(&Easing::SmoothStep, 0.0f, 1.0f, m_fadeOutTime, CS::TweenPlayMode::k_once, 0.0f, 0.0f, [=]()
+                                              {
+                                                  CS::Application::Get()->GetStateManager()->Change(m_targetState);
+                                              });
             
             m_targetState = in_newState;
             m_transitionOutStartedEvent.NotifyConnections();
@@ -111,14 +113,12 @@ namespace CSPong
         
         GetState()->GetUICanvas()->AddWidget(m_fadeImageView);
         
-        m_fadeTween = CS::MakeSmoothStepTween<f32>(1.0f, 0.0f, m_fadeInTime);
-        m_fadeTween.SetOnEndDelegate([=](CS::SmoothStepTween<f32>* in_tween)
-                                     {
-                                         m_fadeImageView->RemoveFromParent();
-                                         m_transitionState = TransitionState::k_none;
-                                         m_transitionInFinishedEvent.NotifyConnections();
-                                     });
-        m_fadeTween.Play(CS::TweenPlayMode::k_once);
+        m_fadeTween = m_tweenSystem->Play(&Easing::SmoothStep, 1.0f, 0.0f, m_fadeInTime, CS::TweenPlayMode::k_once, 0.0f, 0.0f, [=]()
+                                          {
+                                              m_fadeImageView->RemoveFromParent();
+                                              m_transitionState = TransitionState::k_none;
+                                              m_transitionInFinishedEvent.NotifyConnections();
+                                          });
     }
     //-------------------------------------------------
     //-------------------------------------------------
@@ -126,7 +126,7 @@ namespace CSPong
     {
         if (m_transitionState == TransitionState::k_in || m_transitionState == TransitionState::k_out)
         {
-            f32 value = m_fadeTween.Update(in_deltaTime);
+            f32 value = m_tweenSystem->GetValue(m_fadeTween);
             if(m_fadeImageView->GetParent())
             {
                 m_fadeImageView->SetColour(CS::Colour(0.0f, 0.0f, 0.0f, value));
@@ -0,0 +1,263 @@
+//
+//  TweenPool.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_TWEENPOOL_H_
+#define _APPSOURCE_COMMON_TWEENPOOL_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Tween.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// A reference to a tween in a TweenPool. The generation is
+    /// bumped whenever a slot is reused, so a handle to a stopped
+    /// tween never resolves to the tween that replaced it. A
+    /// default constructed handle refers to nothing.
+    //------------------------------------------------------------
+    template <typename TValue> struct TweenHandle final
+    {
+        u32 m_index = 0;
+        u32 m_generation = 0;
+    };
+    //------------------------------------------------------------
+    /// Contiguous storage for every tween of one value type. The
+    /// per-frame data is packed together and updated in a single
+    /// pass, while the end delegates are held alongside so they
+    /// are only touched when a tween finishes. Stopped tweens
+    /// return their slot to a free list for reuse.
+    ///
+    /// A finished tween keeps its final value until it is
+    /// stopped.
+    //------------------------------------------------------------
+    template <typename TValue> class TweenPool final
+    {
+    public:
+        using EaseFunction = f32(*)(f32);
+        using EndDelegate = std::function<void()>;
+        //------------------------------------------------------------
+        /// Starts a new tween.
+        ///
+        /// @param The easing function.
+        /// @param The start value.
+        /// @param The end value.
+        /// @param The time in seconds from start to end.
+        /// @param Once, once reversed or ping-pong.
+        /// @param The time in seconds before the tween starts.
+        /// @param The time in seconds the end value is held for,
+        /// before turning back when ping-ponging.
+        /// @param Delegate called once the tween finishes. May be
+        /// null.
+        ///
+        /// @return The handle to the tween.
+        //------------------------------------------------------------
+        TweenHandle<TValue> Add(EaseFunction in_ease, const TValue& in_from, const TValue& in_to, f32 in_duration, CS::TweenPlayMode in_playMode, f32 in_startDelay, f32 in_endDelay, const EndDelegate& in_endDelegate)
+        {
+            CS_ASSERT(in_playMode == CS::TweenPlayMode::k_once || in_playMode == CS::TweenPlayMode::k_onceReverse || in_playMode == CS::TweenPlayMode::k_pingPong, "Unsupported tween play mode.");
+            
+            u32 index = 0;
+            if (m_freeIndices.empty() == false)
+            {
+                index = m_freeIndices.back();
+                m_freeIndices.pop_back();
+            }
+            else
+            {
+                index = u32(m_tweens.size());
+                m_tweens.push_back(Tween());
+                m_endDelegates.push_back(nullptr);
+            }
+            
+            Tween& tween = m_tweens[index];
+            tween.m_ease = in_ease;
+            tween.m_from = in_from;
+            tween.m_delta = in_to - in_from;
+            tween.m_duration = in_duration;
+            tween.m_startDelay = in_startDelay;
+            tween.m_endDelay = in_endDelay;
+            tween.m_time = 0.0f;
+            tween.m_playMode = in_playMode;
+            tween.m_inUse = true;
+            tween.m_finished = false;
+            tween.m_value = Evaluate(tween);
+            m_endDelegates[index] = in_endDelegate;
+            
+            TweenHandle<TValue> handle;
+            handle.m_index = index;
+            handle.m_generation = tween.m_generation;
+            return handle;
+        }
+        //------------------------------------------------------------
+        /// Stops the tween and frees its slot. Does nothing if the
+        /// handle no longer refers to a tween.
+        ///
+        /// @param The handle.
+        //------------------------------------------------------------
+        void Remove(const TweenHandle<TValue>& in_handle)
+        {
+            if (IsValid(in_handle) == true)
+            {
+                Tween& tween = m_tweens[in_handle.m_index];
+                tween.m_inUse = false;
+                ++tween.m_generation;
+                m_endDelegates[in_handle.m_index] = nullptr;
+                m_freeIndices.push_back(in_handle.m_index);
+            }
+        }
+        //------------------------------------------------------------
+        /// @param The handle.
+        ///
+        /// @return Whether the handle refers to a tween that has
+        /// not been stopped.
+        //------------------------------------------------------------
+        bool IsValid(const TweenHandle<TValue>& in_handle) const
+        {
+            return in_handle.m_index < u32(m_tweens.size()) && m_tweens[in_handle.m_index].m_inUse == true && m_tweens[in_handle.m_index].m_generation == in_handle.m_generation;
+        }
+        //------------------------------------------------------------
+        /// @param A valid handle.
+        ///
+        /// @return The current value of the tween.
+        //------------------------------------------------------------
+        const TValue& GetValue(const TweenHandle<TValue>& in_handle) const
+        {
+            CS_ASSERT(IsValid(in_handle) == true, "Invalid tween handle.");
+            return m_tweens[in_handle.m_index].m_value;
+        }
+        //------------------------------------------------------------
+        /// @param The handle.
+        ///
+        /// @return Whether the tween has played to the end. Stopped
+        /// tweens count as finished.
+        //------------------------------------------------------------
+        bool IsFinished(const TweenHandle<TValue>& in_handle) const
+        {
+            return IsValid(in_handle) == false || m_tweens[in_handle.m_index].m_finished == true;
+        }
+        //------------------------------------------------------------
+        /// Advances every playing tween. The end delegates of any
+        /// that finish are moved out to be called once every pool
+        /// has been updated.
+        ///
+        /// @param The time in seconds.
+        /// @param [Out] The end delegates to call.
+        //------------------------------------------------------------
+        void Update(f32 in_timeSinceLastUpdate, std::vector<EndDelegate>& out_endDelegates)
+        {
+            for (u32 i = 0; i < u32(m_tweens.size()); ++i)
+            {
+                Tween& tween = m_tweens[i];
+                if (tween.m_inUse == false || tween.m_finished == true)
+                {
+                    continue;
+                }
+                
+                f32 totalTime = GetTotalTime(tween);
+                tween.m_time = std::min(tween.m_time + in_timeSinceLastUpdate, totalTime);
+                tween.m_value = Evaluate(tween);
+                
+                if (tween.m_time >= totalTime)
+                {
+                    tween.m_finished = true;
+                    if (m_endDelegates[i] != nullptr)
+                    {
+                        out_endDelegates.push_back(std::move(m_endDelegates[i]));
+                        m_endDelegates[i] = nullptr;
+                    }
+                }
+            }
+        }
+        
+    private:
+        //------------------------------------------------------------
+        /// The per-frame data of a single tween.
+        //------------------------------------------------------------
+        struct Tween final
+        {
+            EaseFunction m_ease = nullptr;
+            TValue m_from = TValue();
+            TValue m_delta = TValue();
+            TValue m_value = TValue();
+            f32 m_duration = 0.0f;
+            f32 m_startDelay = 0.0f;
+            f32 m_endDelay = 0.0f;
+            f32 m_time = 0.0f;
+            CS::TweenPlayMode m_playMode = CS::TweenPlayMode::k_once;
+            u32 m_generation = 1;
+            bool m_inUse = false;
+            bool m_finished = false;
+        };
+        //------------------------------------------------------------
+        /// @param The tween.
+        ///
+        /// @return The time in seconds the tween plays for,
+        /// including its delays.
+        //------------------------------------------------------------
+        static f32 GetTotalTime(const Tween& in_tween)
+        {
+            f32 numPasses = (in_tween.m_playMode == CS::TweenPlayMode::k_pingPong) ? 2.0f : 1.0f;
+            return in_tween.m_startDelay + in_tween.m_duration * numPasses + in_tween.m_endDelay;
+        }
+        //------------------------------------------------------------
+        /// @param The tween.
+        ///
+        /// @return The value of the tween at its current time.
+        //------------------------------------------------------------
+        static TValue Evaluate(const Tween& in_tween)
+        {
+            f32 time = std::max(in_tween.m_time - in_tween.m_startDelay, 0.0f);
+            
+            //Ping-pong holds at the end value for the end delay before turning back
+            if (in_tween.m_playMode == CS::TweenPlayMode::k_pingPong && time > in_tween.m_duration)
+            {
+                time = std::max(in_tween.m_duration * 2.0f + in_tween.m_endDelay - time, 0.0f);
+                time = std::min(time, in_tween.m_duration);
+            }
+            
+            f32 t = (in_tween.m_duration > 0.0f) ? std::min(time / in_tween.m_duration, 1.0f) : 1.0f;
+            if (in_tween.m_playMode == CS::TweenPlayMode::k_onceReverse)
+            {
+                t = 1.0f - t;
+            }
+            
+            return in_tween.m_from + in_tween.m_delta * in_tween.m_ease(t);
+        }
+        
+        std::vector<Tween> m_tweens;
+        std::vector<EndDelegate> m_endDelegates;
+        std::vector<u32> m_freeIndices;
+    };
+}
+
+#endif
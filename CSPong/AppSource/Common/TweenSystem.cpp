@@ -0,0 +1,61 @@
+//
+//  TweenSystem.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/TweenSystem.h>
+
+namespace CSPong
+{
+    CS_DEFINE_NAMEDTYPE(TweenSystem);
+    //-------------------------------------------------
+    //-------------------------------------------------
+    TweenSystemUPtr TweenSystem::Create()
+    {
+        return TweenSystemUPtr(new TweenSystem());
+    }
+    //-------------------------------------------------
+    //-------------------------------------------------
+    bool TweenSystem::IsA(CS::InterfaceIDType in_interfaceId) const
+    {
+        return (TweenSystem::InterfaceID == in_interfaceId);
+    }
+    //-------------------------------------------------
+    //-------------------------------------------------
+    void TweenSystem::OnUpdate(f32 in_deltaTime)
+    {
+        m_floatTweens.Update(in_deltaTime, m_pendingEndDelegates);
+        m_vector2Tweens.Update(in_deltaTime, m_pendingEndDelegates);
+        
+        //Swapped out so that the queue is empty before any delegate runs
+        std::vector<EndDelegate> endDelegates;
+        endDelegates.swap(m_pendingEndDelegates);
+        for (const auto& endDelegate : endDelegates)
+        {
+            endDelegate();
+        }
+    }
+}
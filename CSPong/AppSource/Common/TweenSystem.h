@@ -0,0 +1,162 @@
+//
+//  TweenSystem.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_TWEENSYSTEM_H_
+#define _APPSOURCE_COMMON_TWEENSYSTEM_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/System.h>
+
+#include <Common/TweenPool.h>
+
+#include <functional>
+#include <vector>
+
+namespace CSPong
+{
+    //---------------------------------------------------------
+    /// Plays every tween in a state. Tweens are held in one
+    /// contiguous pool per value type and all of them are
+    /// updated in a single pass each frame. End delegates are
+    /// queued during the pass and called once it is complete,
+    /// so a delegate can safely start or stop tweens.
+    ///
+    /// Owners hold a handle and read the tween's value through
+    /// the system. The system should be created before any
+    /// system that reads tweens so that the values are up to
+    /// date when they are read.
+    ///
+    /// Supports f32 and Vector2 tweens.
+    //---------------------------------------------------------
+    class TweenSystem final : public CS::StateSystem
+    {
+    public:
+        CS_DECLARE_NAMEDTYPE(TweenSystem);
+        
+        using EaseFunction = f32(*)(f32);
+        using EndDelegate = std::function<void()>;
+        //-------------------------------------------------
+        /// Creates a new instance of the system.
+        ///
+        /// @return The new instance.
+        //-------------------------------------------------
+        static TweenSystemUPtr Create();
+        //-------------------------------------------------
+        /// Allows querying of whether or not this system
+        /// implements the interface with the given Id.
+        ///
+        /// @param The interface Id.
+        ///
+        /// @return Whether the interface is implemented.
+        //-------------------------------------------------
+        bool IsA(CS::InterfaceIDType in_interfaceId) const override;
+        //-------------------------------------------------
+        /// Starts a new tween.
+        ///
+        /// @param The easing function.
+        /// @param The start value.
+        /// @param The end value.
+        /// @param The time in seconds from start to end.
+        /// @param Once, once reversed or ping-pong.
+        /// @param The time in seconds before the tween starts.
+        /// @param The time in seconds the end value is held
+        /// for, before turning back when ping-ponging.
+        /// @param Delegate called once the tween finishes. May
+        /// be null.
+        ///
+        /// @return The handle to the tween. Must be stopped
+        /// once it is no longer needed.
+        //-------------------------------------------------
+        template <typename TValue> TweenHandle<TValue> Play(EaseFunction in_ease, const TValue& in_from, const TValue& in_to, f32 in_duration, CS::TweenPlayMode in_playMode, f32 in_startDelay = 0.0f, f32 in_endDelay = 0.0f, const EndDelegate& in_endDelegate = nullptr)
+        {
+            return GetPool(static_cast<const TValue*>(nullptr)).Add(in_ease, in_from, in_to, in_duration, in_playMode, in_startDelay, in_endDelay, in_endDelegate);
+        }
+        //-------------------------------------------------
+        /// Stops the tween, without calling its end
+        /// delegate, and resets the handle.
+        ///
+        /// @param [In/Out] The handle. Does nothing if it no
+        /// longer refers to a tween.
+        //-------------------------------------------------
+        template <typename TValue> void Stop(TweenHandle<TValue>& inout_handle)
+        {
+            GetPool(static_cast<const TValue*>(nullptr)).Remove(inout_handle);
+            inout_handle = TweenHandle<TValue>();
+        }
+        //-------------------------------------------------
+        /// @param A handle to a tween that has not been
+        /// stopped.
+        ///
+        /// @return The current value of the tween.
+        //-------------------------------------------------
+        template <typename TValue> const TValue& GetValue(const TweenHandle<TValue>& in_handle) const
+        {
+            return GetPool(static_cast<const TValue*>(nullptr)).GetValue(in_handle);
+        }
+        //-------------------------------------------------
+        /// @param The handle.
+        ///
+        /// @return Whether the tween is playing. A stopped
+        /// or finished tween is not.
+        //-------------------------------------------------
+        template <typename TValue> bool IsPlaying(const TweenHandle<TValue>& in_handle) const
+        {
+            return GetPool(static_cast<const TValue*>(nullptr)).IsFinished(in_handle) == false;
+        }
+        
+    private:
+        //-------------------------------------------------
+        /// Private constructor to enforce use of factory
+        /// method.
+        //-------------------------------------------------
+        TweenSystem() = default;
+        //-------------------------------------------------
+        /// Updates every pool then calls the end delegates
+        /// of the tweens that finished.
+        ///
+        /// @param The time since the last frame.
+        //-------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override;
+        //-------------------------------------------------
+        /// @return The pool for the value type, chosen by
+        /// the type of the unused pointer.
+        //-------------------------------------------------
+        TweenPool<f32>& GetPool(const f32*) { return m_floatTweens; }
+        const TweenPool<f32>& GetPool(const f32*) const { return m_floatTweens; }
+        TweenPool<CS::Vector2>& GetPool(const CS::Vector2*) { return m_vector2Tweens; }
+        const TweenPool<CS::Vector2>& GetPool(const CS::Vector2*) const { return m_vector2Tweens; }
+        
+        TweenPool<f32> m_floatTweens;
+        TweenPool<CS::Vector2> m_vector2Tweens;
+        std::vector<EndDelegate> m_pendingEndDelegates;
+    };
+}
+
+#endif
@@ -36,15 +36,25 @@ namespace CSPong
     CS_FORWARDDECLARE_CLASS(AIControllerComponent);
     CS_FORWARDDECLARE_CLASS(BallControllerComponent);
     CS_FORWARDDECLARE_CLASS(CameraTiltComponent);
+    CS_FORWARDDECLARE_CLASS(DigitSpriteBinding);
     CS_FORWARDDECLARE_CLASS(DynamicBodyComponent);
     CS_FORWARDDECLARE_CLASS(GameEntityFactory);
     CS_FORWARDDECLARE_CLASS(GoalCeremonySystem);
+    CS_FORWARDDECLARE_CLASS(MatchScheduler);
+    CS_FORWARDDECLARE_CLASS(MatchServer);
+    CS_FORWARDDECLARE_CLASS(MatchServerState);
+    CS_FORWARDDECLARE_CLASS(MatchSimulation);
     CS_FORWARDDECLARE_CLASS(PhysicsSystem);
     CS_FORWARDDECLARE_CLASS(ScoringSystem);
+    CS_FORWARDDECLARE_CLASS(SpectatorBroadcaster);
     CS_FORWARDDECLARE_CLASS(StaticBodyComponent);
+    CS_FORWARDDECLARE_CLASS(StressState);
+    CS_FORWARDDECLARE_CLASS(SyntheticClientLoad);
     CS_FORWARDDECLARE_CLASS(TouchControllerComponent);
     CS_FORWARDDECLARE_CLASS(TransitionSystem);
     CS_FORWARDDECLARE_CLASS(TriggerComponent);
+    CS_FORWARDDECLARE_CLASS(TweenSystem);
+    CS_FORWARDDECLARE_CLASS(UdpSocket);
 }
 
 #endif
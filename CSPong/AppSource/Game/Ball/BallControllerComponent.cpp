@@ -97,12 +97,31 @@ namespace CSPong
         {
             m_active = false;
             
-            GetEntity()->GetTransform().SetPosition(CS::Vector3::k_zero);
+            m_dynamicBodyComponent->SetPosition(CS::Vector2::k_zero);
             m_dynamicBodyComponent->SetVelocity(CS::Vector2());
         }
     }
     //----------------------------------------------------
     //----------------------------------------------------
+    void BallControllerComponent::Reset()
+    {
+        m_active = false;
+        m_currentDirection = CS::Vector2::k_zero;
+    }
+    //----------------------------------------------------
+    //----------------------------------------------------
+    void BallControllerComponent::SetSlot(u32 in_slot)
+    {
+        m_slot = in_slot;
+    }
+    //----------------------------------------------------
+    //----------------------------------------------------
+    u32 BallControllerComponent::GetSlot() const
+    {
+        return m_slot;
+    }
+    //----------------------------------------------------
+    //----------------------------------------------------
     void BallControllerComponent::OnCollision(const CS::Vector2& in_direction, CS::Entity* in_collidedWith)
     {
         m_currentDirection -= 2.0f * in_direction * CS::Vector2::DotProduct(m_currentDirection, in_direction);
@@ -74,6 +74,24 @@ namespace CSPong
         /// @author S Downie
         //----------------------------------------------------
         void Deactivate();
+        //----------------------------------------------------
+        /// Returns the controller to its initial inactive state
+        /// without touching the entity. Used when the ball is
+        /// released back to its pool.
+        //----------------------------------------------------
+        void Reset();
+        //----------------------------------------------------
+        /// Sets an index that the owner of a pooled ball can
+        /// use to find its own record of the ball, such as a
+        /// slot in a flat array, without a lookup table.
+        ///
+        /// @param The slot index.
+        //----------------------------------------------------
+        void SetSlot(u32 in_slot);
+        //----------------------------------------------------
+        /// @return The slot index last set by the owner.
+        //----------------------------------------------------
+        u32 GetSlot() const;
 
     private:
         //----------------------------------------------------
@@ -94,6 +112,7 @@ namespace CSPong
         CS::Vector2 m_currentDirection;
         CS::EventConnectionUPtr m_collisionConnection;
         
+        u32 m_slot = 0;
         bool m_active = true;
     };
 }
@@ -0,0 +1,74 @@
+//
+//  DigitSpriteBinding.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Game/DigitSpriteBinding.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Rendering/Sprite.h>
+
+#include <array>
+#include <string>
+
+namespace CSPong
+{
+    namespace
+    {
+        const u32 k_numDigits = 10;
+        
+        //------------------------------------------------------------
+        /// @return The texture atlas ids of the digits, indexed by
+        /// digit.
+        //------------------------------------------------------------
+        const std::array<std::string, k_numDigits>& GetAtlasIds()
+        {
+            static const std::array<std::string, k_numDigits> k_atlasIds = {{ "0", "1", "2", "3", "4", "5", "6", "7", "8", "9" }};
+            return k_atlasIds;
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    DigitSpriteBinding::DigitSpriteBinding(const CS::SpriteComponentSPtr& in_sprite, u32 in_digit)
+    : m_sprite(in_sprite), m_digit(in_digit)
+    {
+        CS_ASSERT(m_sprite != nullptr, "Digit binding requires a sprite.");
+        CS_ASSERT(m_digit < k_numDigits, "Digit out of range.");
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void DigitSpriteBinding::SetDigit(u32 in_digit)
+    {
+        CS_ASSERT(m_sprite != nullptr, "Cannot set the digit of an unbound binding.");
+        CS_ASSERT(in_digit < k_numDigits, "Digit out of range.");
+        
+        if(in_digit != m_digit)
+        {
+            m_digit = in_digit;
+            m_sprite->SetTextureAtlasId(GetAtlasIds()[in_digit]);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+//
+//  DigitSpriteBinding.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_GAME_DIGITSPRITEBINDING_H_
+#define _APPSOURCE_GAME_DIGITSPRITEBINDING_H_
+
+#include <ForwardDeclarations.h>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// Binds a single digit to a sprite using the digits texture
+    /// atlas. The displayed digit is cached so the sprite is only
+    /// changed when the digit is, and the atlas ids are shared
+    /// rather than built for every change.
+    //------------------------------------------------------------
+    class DigitSpriteBinding final
+    {
+    public:
+        //------------------------------------------------------------
+        /// Creates a binding to nothing. Must be assigned a bound
+        /// one before a digit is set.
+        //------------------------------------------------------------
+        DigitSpriteBinding() = default;
+        //------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @param The sprite to display the digit in.
+        /// @param The digit the sprite currently displays.
+        //------------------------------------------------------------
+        DigitSpriteBinding(const CS::SpriteComponentSPtr& in_sprite, u32 in_digit);
+        //------------------------------------------------------------
+        /// Displays the digit, unless it is already being displayed.
+        ///
+        /// @param The digit, from 0 to 9.
+        //------------------------------------------------------------
+        void SetDigit(u32 in_digit);
+        
+    private:
+        CS::SpriteComponentSPtr m_sprite;
+        u32 m_digit = 0;
+    };
+}
+
+#endif
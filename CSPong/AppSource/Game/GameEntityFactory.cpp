@@ -39,6 +39,7 @@
 
 #include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Entity.h>
+#include <ChilliSource/Core/Math.h>
 #include <ChilliSource/Core/Resource.h>
 #include <ChilliSource/Rendering/Base.h>
 #include <ChilliSource/Rendering/Camera.h>
@@ -78,6 +79,101 @@ namespace CSPong
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
+    void GameEntityFactory::OnInit()
+    {
+        /*
+         =============================
+         Chilli Source Tour: Resources
+         =============================
+         
+         In Chilli Source all resources are contained in the Resource Pool and loaded using a consistent API. When trying to load a
+         resource the pool is queried instead of loading directly from disk. If the pool already
+         contains a loaded version of the resource this will be returned. If not, the Resource Pool
+         will load it from disk. All loaded resources are immutable and are therefore returned
+         as const shared pointers.
+         
+            CS::TextureCSPtr texture = resourcePool->LoadResource<CS::Texture>(CS::StorageLocation::k_package, "Texture.png");
+         
+         The resource pool provides methods for asynchonous loading. In this case the resource is
+         not returned immediately instead being returned through a callback provided when calling
+         load.
+         
+             resourcePool->LoadResourceAsync<CS::Texture>(CS::StorageLocation::k_package, "Texture.png", [](const CS::TextureCSPtr& in_texture)
+             {
+                //Do something.
+             });
+         
+         Resources can also be created manually using the CreateResource() method. In this case
+         the resource is still pooled but it must be given a unique identifier and a mutable 
+         instance is returned. This can be queried from the pool using GetResource().
+         
+             CS::TextureSPtr mutableTexture = resourcePool->CreateResource("MyTexture");
+             CS::TextureCSPtr texture = resourcePool->GetResource("MyTexture");
+         
+         Resources that are created manually must also be built manually (for instance texture has a build method that takes in image data, format, etc).
+         
+         If the application receives a memory warning the Resource Pool will release any resources
+         that are no-longer in use. This can also be performed manually by calling ReleaseAllUnused().
+         
+         -----------------------------
+         
+         Next: 'Materials' in GameEntityFactory::OnInit()
+         */
+        
+        auto resourcePool = CS::Application::Get()->GetResourcePool();
+        m_ballModel = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Ball.csmodel");
+        m_playerPaddleModel = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Paddle/PaddleLeft.csmodel");
+        m_oppositionPaddleModel = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Paddle/PaddleRight.csmodel");
+        m_arenaModel = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Arena.csmodel");
+        
+        /*
+         =============================
+         Chilli Source Tour: Materials
+         =============================
+         
+         In Chilli Source a material is a resource that contains a collection of rendering settings.
+         This includes the textures that should be used, the lighting surface values and render options
+         like the cull mode.
+         
+         Materials also have a type. This type determines which shaders should be used to render it.
+         For example an AnimatedBlinn material will use the shaders required for applying blinn-phong 
+         shading to an animated model or Sprite material is used to render standard 2D sprites. 
+         The custom type can also be used to specify custom shaders.
+         
+         Unlike most resources it is often convenient to create materials in code instead of loading 
+         from disk. To help with this a material factory has been provided with convienence
+         methods for creating mutable instances of each of the material types.
+         
+            CS::MaterialFactory* materialFactory = CS::Application::Get()->GetSystem<MaterialFactory>();
+            CS::MaterialSPtr spriteMaterial = materialFactory->CreateSprite("UniqueId", texture);
+         
+         Objects with the same material can be rendered in the same batch and therefore it is important to reduce the number of materials by batching textures.
+         
+         -----------------------------
+         
+         Next: 'Texture Atlases' in GameEntityFactory::CreateScoreSprite()
+         */
+        
+        m_modelMaterial = resourcePool->LoadResource<CS::Material>(CS::StorageLocation::k_package, "Materials/Models/Models.csmaterial");
+        
+        m_paddleOffsetX = m_arenaModel->GetAABB().GetSize().x * k_paddlePercentageOffsetFromCentre;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void GameEntityFactory::OnDestroy()
+    {
+        m_freeBalls.clear();
+        m_freePlayerPaddles.clear();
+        m_freeOppositionPaddles.clear();
+        
+        m_ballModel.reset();
+        m_playerPaddleModel.reset();
+        m_oppositionPaddleModel.reset();
+        m_arenaModel.reset();
+        m_modelMaterial.reset();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
     CS::EntityUPtr GameEntityFactory::CreateCamera() const
     {
         /*
@@ -189,7 +285,7 @@ namespace CSPong
          
          ----------------------------
          
-         Next: 'Resources' in GameEntityFactory::CreateBall()
+         Next: 'Resources' in GameEntityFactory::OnInit()
          */
         
         CS::EntityUPtr light(CS::Entity::Create());
@@ -221,86 +317,118 @@ namespace CSPong
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
-    CS::EntityUPtr GameEntityFactory::CreateBall() const
+    void GameEntityFactory::WarmPools(u32 in_numBalls, u32 in_numPaddles)
     {
-        /*
-         =============================
-         Chilli Source Tour: Resources
-         =============================
-         
-         In Chilli Source all resources are contained in the Resource Pool and loaded using a consistent API. When trying to load a
-         resource the pool is queried instead of loading directly from disk. If the pool already
-         contains a loaded version of the resource this will be returned. If not, the Resource Pool
-         will load it from disk. All loaded resources are immutable and are therefore returned
-         as const shared pointers.
-         
-            CS::TextureCSPtr texture = resourcePool->LoadResource<CS::Texture>(CS::StorageLocation::k_package, "Texture.png");
-         
-         The resource pool provides methods for asynchonous loading. In this case the resource is
-         not returned immediately instead being returned through a callback provided when calling
-         load.
-         
-             resourcePool->LoadResourceAsync<CS::Texture>(CS::StorageLocation::k_package, "Texture.png", [](const CS::TextureCSPtr& in_texture)
-             {
-                //Do something.
-             });
-         
-         Resources can also be created manually using the CreateResource() method. In this case
-         the resource is still pooled but it must be given a unique identifier and a mutable 
-         instance is returned. This can be queried from the pool using GetResource().
-         
-             CS::TextureSPtr mutableTexture = resourcePool->CreateResource("MyTexture");
-             CS::TextureCSPtr texture = resourcePool->GetResource("MyTexture");
-         
-         Resources that are created manually must also be built manually (for instance texture has a build method that takes in image data, format, etc).
-         
-         If the application receives a memory warning the Resource Pool will release any resources
-         that are no-longer in use. This can also be performed manually by calling ReleaseAllUnused().
-         
-         -----------------------------
-         
-         Next: 'Materials' in GameEntityFactory::CreateBall()
-         */
+        m_freeBalls.reserve(in_numBalls);
+        while (m_freeBalls.size() < in_numBalls)
+        {
+            m_freeBalls.push_back(CreateBall());
+        }
+        
+        m_freePlayerPaddles.reserve(in_numPaddles);
+        while (m_freePlayerPaddles.size() < in_numPaddles)
+        {
+            m_freePlayerPaddles.push_back(CreatePlayerPaddle());
+        }
+        
+        m_freeOppositionPaddles.reserve(in_numPaddles);
+        while (m_freeOppositionPaddles.size() < in_numPaddles)
+        {
+            m_freeOppositionPaddles.push_back(CreateOppositionPaddle());
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    CS::EntitySPtr GameEntityFactory::AcquireBall()
+    {
+        if (m_freeBalls.empty() == true)
+        {
+            return CreateBall();
+        }
         
-        auto resourcePool = CS::Application::Get()->GetResourcePool();
-        CS::ModelCSPtr mesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Ball.csmodel");
+        CS::EntitySPtr ball = m_freeBalls.back();
+        m_freeBalls.pop_back();
+        return ball;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void GameEntityFactory::ReleaseBall(const CS::EntitySPtr& in_ball)
+    {
+        CS_ASSERT(in_ball->GetComponent<BallControllerComponent>() != nullptr, "Only balls can be released to the ball pool.");
         
-        /*
-         =============================
-         Chilli Source Tour: Materials
-         =============================
-         
-         In Chilli Source a material is a resource that contains a collection of rendering settings.
-         This includes the textures that should be used, the lighting surface values and render options
-         like the cull mode.
-         
-         Materials also have a type. This type determines which shaders should be used to render it.
-         For example an AnimatedBlinn material will use the shaders required for applying blinn-phong 
-         shading to an animated model or Sprite material is used to render standard 2D sprites. 
-         The custom type can also be used to specify custom shaders.
-         
-         Unlike most resources it is often convenient to create materials in code instead of loading 
-         from disk. To help with this a material factory has been provided with convienence
-         methods for creating mutable instances of each of the material types.
-         
-            CS::MaterialFactory* materialFactory = CS::Application::Get()->GetSystem<MaterialFactory>();
-            CS::MaterialSPtr spriteMaterial = materialFactory->CreateSprite("UniqueId", texture);
-         
-         Objects with the same material can be rendered in the same batch and therefore it is important to reduce the number of materials by batching textures.
-         
-         -----------------------------
-         
-         Next: 'Texture Atlases' in GameEntityFactory::CreateScoreSprite()
-         */
+        in_ball->GetComponent<BallControllerComponent>()->Reset();
+        ResetPooledEntity(in_ball, CS::Vector3::k_zero);
         
-        CS::MaterialCSPtr material = resourcePool->LoadResource<CS::Material>(CS::StorageLocation::k_package, "Materials/Models/Models.csmaterial");
+        m_freeBalls.push_back(in_ball);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    CS::EntitySPtr GameEntityFactory::AcquirePlayerPaddle(const CS::EntitySPtr& in_camera)
+    {
+        CS::EntitySPtr paddle;
+        if (m_freePlayerPaddles.empty() == true)
+        {
+            paddle = CreatePlayerPaddle();
+        }
+        else
+        {
+            paddle = m_freePlayerPaddles.back();
+            m_freePlayerPaddles.pop_back();
+        }
+        
+        paddle->GetComponent<TouchControllerComponent>()->SetCameraComponent(in_camera->GetComponent<CS::CameraComponent>());
+        return paddle;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void GameEntityFactory::ReleasePlayerPaddle(const CS::EntitySPtr& in_paddle)
+    {
+        CS_ASSERT(in_paddle->GetComponent<TouchControllerComponent>() != nullptr, "Only player paddles can be released to the player paddle pool.");
         
-        CS::EntityUPtr ball(CS::Entity::Create());
+        in_paddle->GetComponent<TouchControllerComponent>()->Reset();
+        ResetPooledEntity(in_paddle, CS::Vector3(-m_paddleOffsetX, 0.0f, 0.0f));
         
-        CS::StaticModelComponentSPtr meshComponent = std::make_shared<CS::StaticModelComponent>(mesh, material);
+        m_freePlayerPaddles.push_back(in_paddle);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    CS::EntitySPtr GameEntityFactory::AcquireOppositionPaddle(const CS::EntitySPtr& in_ball)
+    {
+        CS::EntitySPtr paddle;
+        if (m_freeOppositionPaddles.empty() == true)
+        {
+            paddle = CreateOppositionPaddle();
+        }
+        else
+        {
+            paddle = m_freeOppositionPaddles.back();
+            m_freeOppositionPaddles.pop_back();
+        }
+        
+        paddle->GetComponent<AIControllerComponent>()->SetTarget(in_ball);
+        return paddle;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void GameEntityFactory::ReleaseOppositionPaddle(const CS::EntitySPtr& in_paddle)
+    {
+        CS_ASSERT(in_paddle->GetComponent<AIControllerComponent>() != nullptr, "Only opposition paddles can be released to the opposition paddle pool.");
+        
+        in_paddle->GetComponent<AIControllerComponent>()->SetTarget(nullptr);
+        ResetPooledEntity(in_paddle, CS::Vector3(m_paddleOffsetX, 0.0f, 0.0f));
+        
+        m_freeOppositionPaddles.push_back(in_paddle);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    CS::EntitySPtr GameEntityFactory::CreateBall() const
+    {
+        CS::EntitySPtr ball(CS::Entity::Create());
+        
+        CS::StaticModelComponentSPtr meshComponent = std::make_shared<CS::StaticModelComponent>(m_ballModel, m_modelMaterial);
         ball->AddComponent(meshComponent);
         
-        CS::Vector2 collisionSize = mesh->GetAABB().GetSize().XY();
+        CS::Vector2 collisionSize = m_ballModel->GetAABB().GetSize().XY();
         DynamicBodyComponentSPtr dynamicBody(new DynamicBodyComponent(m_physicsSystem, collisionSize, 1.0f, 0.0f, 1.0f));
         ball->AddComponent(dynamicBody);
         
@@ -313,73 +441,67 @@ namespace CSPong
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
-    CS::EntityUPtr GameEntityFactory::CreatePlayerPaddle(const CS::EntitySPtr& in_camera) const
+    CS::EntitySPtr GameEntityFactory::CreatePlayerPaddle() const
     {
-        CS::EntityUPtr paddle(CS::Entity::Create());
-        
-        auto resourcePool = CS::Application::Get()->GetResourcePool();
+        CS::EntitySPtr paddle(CS::Entity::Create());
         
-        CS::ModelCSPtr mesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Paddle/PaddleLeft.csmodel");
-        CS::MaterialCSPtr material = resourcePool->LoadResource<CS::Material>(CS::StorageLocation::k_package, "Materials/Models/Models.csmaterial");
-        
-        CS::StaticModelComponentSPtr meshComponent = std::make_shared<CS::StaticModelComponent>(mesh, material);
+        CS::StaticModelComponentSPtr meshComponent = std::make_shared<CS::StaticModelComponent>(m_playerPaddleModel, m_modelMaterial);
         paddle->AddComponent(meshComponent);
         
-        CS::Vector2 collisionSize = mesh->GetAABB().GetSize().XY();
+        CS::Vector2 collisionSize = m_playerPaddleModel->GetAABB().GetSize().XY();
         DynamicBodyComponentSPtr dynamicBody(new DynamicBodyComponent(m_physicsSystem, collisionSize, 100.0f, 0.2f, 0.6f));
         paddle->AddComponent(dynamicBody);
         
-        TouchControllerComponentSPtr touchComponent(new TouchControllerComponent(dynamicBody, in_camera->GetComponent<CS::CameraComponent>()));
+        TouchControllerComponentSPtr touchComponent(new TouchControllerComponent(dynamicBody, nullptr));
         paddle->AddComponent(touchComponent);
         
-        CS::ModelCSPtr arenaMesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Arena.csmodel");
-        f32 offsetX = arenaMesh->GetAABB().GetSize().x * -k_paddlePercentageOffsetFromCentre;
-        paddle->GetTransform().SetPosition(offsetX, 0.0f, 0.0f);
+        paddle->GetTransform().SetPosition(-m_paddleOffsetX, 0.0f, 0.0f);
         
         return paddle;
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
-    CS::EntityUPtr GameEntityFactory::CreateOppositionPaddle(const CS::EntitySPtr& in_ball) const
+    CS::EntitySPtr GameEntityFactory::CreateOppositionPaddle() const
     {
-        CS::EntityUPtr paddle(CS::Entity::Create());
-        
-        auto resourcePool = CS::Application::Get()->GetResourcePool();
+        CS::EntitySPtr paddle(CS::Entity::Create());
         
-        CS::ModelCSPtr mesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Paddle/PaddleRight.csmodel");
-        CS::MaterialCSPtr material = resourcePool->LoadResource<CS::Material>(CS::StorageLocation::k_package, "Materials/Models/Models.csmaterial");
-        
-        CS::StaticModelComponentSPtr meshComponent = std::make_shared<CS::StaticModelComponent>(mesh, material);
+        CS::StaticModelComponentSPtr meshComponent = std::make_shared<CS::StaticModelComponent>(m_oppositionPaddleModel, m_modelMaterial);
         paddle->AddComponent(meshComponent);
         
-        CS::Vector2 collisionSize = mesh->GetAABB().GetSize().XY();
+        CS::Vector2 collisionSize = m_oppositionPaddleModel->GetAABB().GetSize().XY();
         DynamicBodyComponentSPtr dynamicBody(new DynamicBodyComponent(m_physicsSystem, collisionSize, 100.0f, 0.2f, 0.6f));
         paddle->AddComponent(dynamicBody);
         
-        AIControllerComponentSPtr aiComponent(new AIControllerComponent(dynamicBody, in_ball));
+        AIControllerComponentSPtr aiComponent(new AIControllerComponent(dynamicBody, nullptr));
         paddle->AddComponent(aiComponent);
         
-        CS::ModelCSPtr arenaMesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Arena.csmodel");
-        f32 offsetX = arenaMesh->GetAABB().GetSize().x * k_paddlePercentageOffsetFromCentre;
-        paddle->GetTransform().SetPosition(offsetX, 0.0f, 0.0f);
+        paddle->GetTransform().SetPosition(m_paddleOffsetX, 0.0f, 0.0f);
         
         return paddle;
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
+    void GameEntityFactory::ResetPooledEntity(const CS::EntitySPtr& in_entity, const CS::Vector3& in_position) const
+    {
+        if (in_entity->GetScene() != nullptr)
+        {
+            in_entity->RemoveFromParent();
+        }
+        
+        in_entity->GetTransform().SetPosition(in_position);
+        in_entity->GetTransform().SetOrientation(CS::Quaternion::k_identity);
+        in_entity->GetComponent<DynamicBodyComponent>()->Reset();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
     CS::EntityUPtr GameEntityFactory::CreateArena() const
     {
         CS::EntityUPtr arena(CS::Entity::Create());
         
-        auto resourcePool = CS::Application::Get()->GetResourcePool();
-        
-        CS::ModelCSPtr mesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Arena.csmodel");
-        CS::MaterialCSPtr material = resourcePool->LoadResource<CS::Material>(CS::StorageLocation::k_package, "Materials/Models/Models.csmaterial");
-        
         const f32 k_border = 1.0f;
-        const CS::Vector2 k_arenaDimensions(mesh->GetAABB().GetSize().XY() * 0.9f);
+        const CS::Vector2 k_arenaDimensions(m_arenaModel->GetAABB().GetSize().XY() * 0.9f);
         
-        CS::StaticModelComponentSPtr meshComponent = std::make_shared<CS::StaticModelComponent>(mesh, material);
+        CS::StaticModelComponentSPtr meshComponent = std::make_shared<CS::StaticModelComponent>(m_arenaModel, m_modelMaterial);
         meshComponent->SetShadowCastingEnabled(false);
         arena->AddComponent(meshComponent);
         
@@ -34,6 +34,8 @@
 #include <ChilliSource/Core/System.h>
 #include <ChilliSource/Rendering/Base.h>
 
+#include <vector>
+
 namespace CSPong
 {
     //------------------------------------------------------------
@@ -96,42 +98,69 @@ namespace CSPong
         //------------------------------------------------------------
         CS::EntityUPtr CreateDiffuseLight() const;
         //------------------------------------------------------------
-        /// Create the ball entity. The ball entity consists of
-        /// a static model and logic that controls its movement. These
-        /// are added to the entity as components.
+        /// Pre-builds pooled entities so that they can later be
+        /// acquired without allocating.
         ///
-        /// @author S Downie
+        /// @param The number of balls the pool should hold.
+        /// @param The number of each type of paddle the pools
+        /// should hold.
+        //------------------------------------------------------------
+        void WarmPools(u32 in_numBalls, u32 in_numPaddles);
+        //------------------------------------------------------------
+        /// Acquires a ball entity from the pool, building a new one
+        /// only if the pool is empty. The ball entity consists of a
+        /// static model and logic that controls its movement. It is
+        /// positioned at the centre of the arena and inactive.
         ///
-        /// @return Ball entity (NOTE: It returns a unique ptr which
-        /// tells the caller that they take ownership)
+        /// @return Ball entity. This should be returned with
+        /// ReleaseBall() once it is no longer needed.
         //------------------------------------------------------------
-        CS::EntityUPtr CreateBall() const;
+        CS::EntitySPtr AcquireBall();
         //------------------------------------------------------------
-        /// Create the player paddle. This has components for displaying
-        /// the paddle and allowing the player to move it via the
-        /// user input
+        /// Returns a ball to the pool. The ball is removed from the
+        /// scene and its transform, velocity and controller are
+        /// reset, but it is not destroyed.
         ///
-        /// @author S Downie
+        /// @param Ball entity previously acquired from this factory.
+        //------------------------------------------------------------
+        void ReleaseBall(const CS::EntitySPtr& in_ball);
+        //------------------------------------------------------------
+        /// Acquires the player paddle from the pool. This has
+        /// components for displaying the paddle and allowing the
+        /// player to move it via the user input
         ///
         /// @param Camera used for movement
         ///
-        /// @return Paddle entity (NOTE: It returns a unique ptr which
-        /// tells the caller that they take ownership)
+        /// @return Paddle entity. This should be returned with
+        /// ReleasePlayerPaddle() once it is no longer needed.
         //------------------------------------------------------------
-        CS::EntityUPtr CreatePlayerPaddle(const CS::EntitySPtr& in_camera) const;
+        CS::EntitySPtr AcquirePlayerPaddle(const CS::EntitySPtr& in_camera);
         //------------------------------------------------------------
-        /// Create the oppositions paddle. This has components for displaying
-        /// the paddle and AI logic that allows the paddle to move
-        /// autonomously
+        /// Returns a player paddle to the pool, removing it from
+        /// the scene and resetting it to its starting position.
         ///
-        /// @author S Downie
+        /// @param Paddle entity previously acquired from this factory.
+        //------------------------------------------------------------
+        void ReleasePlayerPaddle(const CS::EntitySPtr& in_paddle);
+        //------------------------------------------------------------
+        /// Acquires the oppositions paddle from the pool. This has
+        /// components for displaying the paddle and AI logic that
+        /// allows the paddle to move autonomously
         ///
         /// @param Ball to chase
         ///
-        /// @return Paddle entity (NOTE: It returns a unique ptr which
-        /// tells the caller that they take ownership)
+        /// @return Paddle entity. This should be returned with
+        /// ReleaseOppositionPaddle() once it is no longer needed.
         //------------------------------------------------------------
-        CS::EntityUPtr CreateOppositionPaddle(const CS::EntitySPtr& in_ball) const;
+        CS::EntitySPtr AcquireOppositionPaddle(const CS::EntitySPtr& in_ball);
+        //------------------------------------------------------------
+        /// Returns an opposition paddle to the pool, removing it
+        /// from the scene, resetting it to its starting position and
+        /// clearing its target.
+        ///
+        /// @param Paddle entity previously acquired from this factory.
+        //------------------------------------------------------------
+        void ReleaseOppositionPaddle(const CS::EntitySPtr& in_paddle);
         //------------------------------------------------------------
         /// Creates the arean. This contains a component for displaying
         /// the stage and child entities representing the edges of the
@@ -170,11 +199,60 @@ namespace CSPong
         /// @param Scoring system
         //----------------------------------------------------------
         GameEntityFactory(PhysicsSystem* in_physicsSystem, ScoringSystem* in_scoringSystem);
+        //----------------------------------------------------------
+        /// Loads the resources used by the pooled entities so that
+        /// they are only looked up once.
+        //----------------------------------------------------------
+        void OnInit() override;
+        //----------------------------------------------------------
+        /// Destroys the pooled entities and releases the cached
+        /// resources.
+        //----------------------------------------------------------
+        void OnDestroy() override;
+        //------------------------------------------------------------
+        /// Builds a new ball entity for the pool.
+        ///
+        /// @return Ball entity.
+        //------------------------------------------------------------
+        CS::EntitySPtr CreateBall() const;
+        //------------------------------------------------------------
+        /// Builds a new player paddle for the pool. The touch
+        /// controller has no camera until the paddle is acquired.
+        ///
+        /// @return Paddle entity.
+        //------------------------------------------------------------
+        CS::EntitySPtr CreatePlayerPaddle() const;
+        //------------------------------------------------------------
+        /// Builds a new opposition paddle for the pool. The AI
+        /// controller has no target until the paddle is acquired.
+        ///
+        /// @return Paddle entity.
+        //------------------------------------------------------------
+        CS::EntitySPtr CreateOppositionPaddle() const;
+        //------------------------------------------------------------
+        /// Removes a pooled entity from the scene and resets its
+        /// transform and body.
+        ///
+        /// @param The entity.
+        /// @param The position to reset to.
+        //------------------------------------------------------------
+        void ResetPooledEntity(const CS::EntitySPtr& in_entity, const CS::Vector3& in_position) const;
         
     private:
         
         PhysicsSystem* m_physicsSystem;
         ScoringSystem* m_scoringSystem;
+        
+        CS::ModelCSPtr m_ballModel;
+        CS::ModelCSPtr m_playerPaddleModel;
+        CS::ModelCSPtr m_oppositionPaddleModel;
+        CS::ModelCSPtr m_arenaModel;
+        CS::MaterialCSPtr m_modelMaterial;
+        f32 m_paddleOffsetX = 0.0f;
+        
+        std::vector<CS::EntitySPtr> m_freeBalls;
+        std::vector<CS::EntitySPtr> m_freePlayerPaddles;
+        std::vector<CS::EntitySPtr> m_freeOppositionPaddles;
     };
 }
 
@@ -29,6 +29,7 @@
 #include <Game/GameState.h>
 
 #include <Common/TransitionSystem.h>
+#include <Common/TweenSystem.h>
 #include <Game/GameEntityFactory.h>
 #include <Game/GoalCeremonySystem.h>
 #include <Game/Ball/BallControllerComponent.h>
@@ -54,10 +55,12 @@ namespace CSPong
     //------------------------------------------------------
     void GameState::CreateSystems()
     {
-        m_transitionSystem = CreateSystem<TransitionSystem>(1.0f, 1.0f);
+        //Tweens are updated first so that the systems reading them see this frame's values
+        auto tweenSystem = CreateSystem<TweenSystem>();
+        m_transitionSystem = CreateSystem<TransitionSystem>(tweenSystem, 1.0f, 1.0f);
         m_physicsSystem = CreateSystem<PhysicsSystem>();
         m_scoringSystem = CreateSystem<ScoringSystem>();
-        m_goalCeremonySystem = CreateSystem<GoalCeremonySystem>();
+        m_goalCeremonySystem = CreateSystem<GoalCeremonySystem>(tweenSystem);
         m_gameEntityFactory = CreateSystem<GameEntityFactory>(m_physicsSystem, m_scoringSystem);
         
 #ifndef CS_TARGETPLATFORM_RPI
@@ -106,13 +109,15 @@ namespace CSPong
         CS::EntitySPtr arena = m_gameEntityFactory->CreateArena();
         GetMainScene()->Add(arena);
         
-        m_ball = m_gameEntityFactory->CreateBall();
+        m_gameEntityFactory->WarmPools(1, 1);
+        
+        m_ball = m_gameEntityFactory->AcquireBall();
         GetMainScene()->Add(m_ball);
         
-        CS::EntitySPtr playerPaddle = m_gameEntityFactory->CreatePlayerPaddle(camera);
-        GetMainScene()->Add(playerPaddle);
+        m_playerPaddle = m_gameEntityFactory->AcquirePlayerPaddle(camera);
+        GetMainScene()->Add(m_playerPaddle);
         
-        m_oppositionPaddle = m_gameEntityFactory->CreateOppositionPaddle(m_ball);
+        m_oppositionPaddle = m_gameEntityFactory->AcquireOppositionPaddle(m_ball);
         GetMainScene()->Add(m_oppositionPaddle);
         
         /*
@@ -194,5 +199,12 @@ namespace CSPong
     void GameState::OnDestroy()
     {
         m_scoreChangedConnection.reset();
+        
+        m_gameEntityFactory->ReleaseOppositionPaddle(m_oppositionPaddle);
+        m_gameEntityFactory->ReleasePlayerPaddle(m_playerPaddle);
+        m_gameEntityFactory->ReleaseBall(m_ball);
+        m_oppositionPaddle.reset();
+        m_playerPaddle.reset();
+        m_ball.reset();
     }
 }
@@ -84,6 +84,7 @@ namespace CSPong
         CS::EventConnectionUPtr m_transitionInConnection;
         
         CS::EntitySPtr m_ball;
+        CS::EntitySPtr m_playerPaddle;
         CS::EntitySPtr m_oppositionPaddle;
         
 #ifndef CS_TARGETPLATFORM_RPI
@@ -28,6 +28,9 @@
 
 #include <Game/GoalCeremonySystem.h>
 
+#include <Common/Easing.h>
+#include <Common/TweenSystem.h>
+
 #include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Resource.h>
 #include <ChilliSource/Core/Scene.h>
@@ -118,9 +121,15 @@ namespace CSPong
     }
     //---------------------------------------------------
     //---------------------------------------------------
-    GoalCeremonySystemUPtr GoalCeremonySystem::Create()
+    GoalCeremonySystemUPtr GoalCeremonySystem::Create(TweenSystem* in_tweenSystem)
+    {
+        return GoalCeremonySystemUPtr(new GoalCeremonySystem(in_tweenSystem));
+    }
+    //----------------------------------------------------------
+    //----------------------------------------------------------
+    GoalCeremonySystem::GoalCeremonySystem(TweenSystem* in_tweenSystem)
+    : m_tweenSystem(in_tweenSystem)
     {
-        return GoalCeremonySystemUPtr(new GoalCeremonySystem());
     }
     //----------------------------------------------------------
     //----------------------------------------------------------
@@ -163,28 +172,26 @@ namespace CSPong
     {
         GetState()->GetUICanvas()->AddWidget(m_currentView);
         
-        m_rotationTween = CS::MakeEaseOutBackTween(0.0f, CS::MathUtils::k_pi * 2.0f, k_ceremonyDuration, k_ceremonyStartDelay, k_ceremonyEndDelay);
-        m_scaleTween = CS::MakeEaseOutBackTween(CS::Vector2::k_zero, CS::Vector2::k_one, k_ceremonyDuration, k_ceremonyStartDelay, k_ceremonyEndDelay);
-        m_scaleTween.SetOnEndDelegate([this, in_endDelegate](CS::EaseOutBackTween<CS::Vector2>*)
+        m_tweenSystem->Stop(m_rotationTween);
+        m_tweenSystem->Stop(m_scaleTween);
+        
+        m_rotationTween = m_tweenSystem->Play(&Easing::EaseOutBack, 0.0f, CS::MathUtils::k_pi * 2.0f, k_ceremonyDuration, CS::TweenPlayMode::k_pingPong, k_ceremonyStartDelay, k_ceremonyEndDelay);
+        m_scaleTween = m_tweenSystem->Play(&Easing::EaseOutBack, CS::Vector2::k_zero, CS::Vector2::k_one, k_ceremonyDuration, CS::TweenPlayMode::k_pingPong, k_ceremonyStartDelay, k_ceremonyEndDelay, [this, in_endDelegate]()
         {
             m_currentView->RemoveFromParent();
             m_currentView->ScaleTo(CS::Vector2(0.0f, 0.0f));
             m_currentView.reset();
             in_endDelegate();
         });
-        m_rotationTween.Play(CS::TweenPlayMode::k_pingPong);
-        m_scaleTween.Play(CS::TweenPlayMode::k_pingPong);
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
     void GoalCeremonySystem::OnUpdate(f32 in_timeSinceLastUpdate)
     {
-        m_rotationTween.Update(in_timeSinceLastUpdate);
-        m_scaleTween.Update(in_timeSinceLastUpdate);
         if(m_currentView != nullptr)
         {
-            m_currentView->ScaleTo(CS::Vector2::Max(m_scaleTween.GetValue(), CS::Vector2::k_zero));
-            m_currentView->RotateTo(m_rotationTween.GetValue());
+            m_currentView->ScaleTo(CS::Vector2::Max(m_tweenSystem->GetValue(m_scaleTween), CS::Vector2::k_zero));
+            m_currentView->RotateTo(m_tweenSystem->GetValue(m_rotationTween));
         }
     }
 }
\ No newline at end of file
@@ -34,7 +34,8 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Math.h>
 #include <ChilliSource/Core/System.h>
-#include <ChilliSource/Core/Tween.h>
+
+#include <Common/TweenPool.h>
 
 #include <functional>
 
@@ -61,9 +62,11 @@ namespace CSPong
         ///
         /// @author S Downie
         ///
+        /// @param The tween system that plays the ceremony.
+        ///
         /// @return The new instance.
         //---------------------------------------------------
-        static GoalCeremonySystemUPtr Create();
+        static GoalCeremonySystemUPtr Create(TweenSystem* in_tweenSystem);
         //----------------------------------------------------------
         /// @author S Downie
         ///
@@ -102,8 +105,10 @@ namespace CSPong
         /// Private constructor to enforce use of factory method
         ///
         /// @author S Downie
+        ///
+        /// @param The tween system that plays the ceremony.
         //----------------------------------------------------------
-        GoalCeremonySystem() = default;
+        GoalCeremonySystem(TweenSystem* in_tweenSystem);
         //------------------------------------------------------------
         /// Called when the state is first placed onto the state manager
         /// stack. This is only called once and is mirrored by OnDestroy().
@@ -132,8 +137,9 @@ namespace CSPong
         
     private:
         
-        CS::EaseOutBackTween<CS::Vector2> m_scaleTween;
-        CS::EaseOutBackTween<f32> m_rotationTween;
+        TweenSystem* m_tweenSystem;
+        TweenHandle<CS::Vector2> m_scaleTween;
+        TweenHandle<f32> m_rotationTween;
         CS::WidgetSPtr m_goalView;
         CS::WidgetSPtr m_winView;
         CS::WidgetSPtr m_loseView;
@@ -45,10 +45,9 @@ namespace CSPong
     //----------------------------------------------------------
     //----------------------------------------------------------
     AIControllerComponent::AIControllerComponent(const DynamicBodyComponentSPtr& in_body, const CS::EntitySPtr& in_targetEntity)
-    : m_body(in_body), m_target(in_targetEntity)
+    : m_body(in_body)
     {
-        m_targetBody = m_target->GetComponent<DynamicBodyComponent>();
-        CS_ASSERT(m_targetBody != nullptr, "Cannot have null target body");
+        SetTarget(in_targetEntity);
     }
     //----------------------------------------------------------
     //----------------------------------------------------------
@@ -61,8 +60,20 @@ namespace CSPong
     void AIControllerComponent::Reset()
     {
         CS_ASSERT(GetEntity() != nullptr, "Must have an entity to reset");
-        CS::Vector3 currentPos(GetEntity()->GetTransform().GetLocalPosition());
-        GetEntity()->GetTransform().SetPosition(currentPos.x, 0.0f, currentPos.z);
+        m_body->SetPosition(CS::Vector2(m_body->GetPosition().x, 0.0f));
+    }
+    //----------------------------------------------------
+    //----------------------------------------------------
+    void AIControllerComponent::SetTarget(const CS::EntitySPtr& in_targetEntity)
+    {
+        m_target = in_targetEntity;
+        m_targetBody.reset();
+        
+        if (m_target != nullptr)
+        {
+            m_targetBody = m_target->GetComponent<DynamicBodyComponent>();
+            CS_ASSERT(m_targetBody != nullptr, "Cannot have null target body");
+        }
     }
     //----------------------------------------------------
     //----------------------------------------------------
@@ -77,12 +88,17 @@ namespace CSPong
     //----------------------------------------------------------
     void AIControllerComponent::OnFixedUpdate(f32 in_timeSinceLastUpdate)
     {
+        if (m_target == nullptr)
+        {
+            return;
+        }
+        
         //If ball is not coming towards us then just return to the centre
-        CS::Vector3 currentPos(GetEntity()->GetTransform().GetWorldPosition());
+        CS::Vector3 currentPos(m_body->GetPosition(), 0.0f);
         CS::Vector3 targetPos;
         if(IsTargetMovingTowardsUs(currentPos) == true)
         {
-            targetPos = m_target->GetTransform().GetWorldPosition();
+            targetPos = CS::Vector3(m_targetBody->GetPosition(), 0.0f);
         }
         else
         {
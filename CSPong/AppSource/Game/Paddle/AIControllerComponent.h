@@ -53,7 +53,8 @@ namespace CSPong
         /// @author S Downie
         ///
         /// @param Physics body used to move the object
-        /// @param Entity to chase (ball)
+        /// @param Entity to chase (ball). May be null if the
+        /// target is set later.
         //----------------------------------------------------------
         AIControllerComponent(const DynamicBodyComponentSPtr& in_body, const CS::EntitySPtr& in_targetEntity);
         //----------------------------------------------------------
@@ -71,6 +72,13 @@ namespace CSPong
         /// @author S Downie
         //----------------------------------------------------
         void Reset();
+        //----------------------------------------------------
+        /// Sets the entity to chase. While there is no target
+        /// the paddle does not move.
+        ///
+        /// @param Entity to chase (ball), or null.
+        //----------------------------------------------------
+        void SetTarget(const CS::EntitySPtr& in_targetEntity);
         
     private:
         
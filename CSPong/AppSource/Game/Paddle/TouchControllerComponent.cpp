@@ -58,6 +58,20 @@ namespace CSPong
     {
         return in_interfaceId == TouchControllerComponent::InterfaceID;
     }
+    //----------------------------------------------------------
+    //----------------------------------------------------------
+    void TouchControllerComponent::SetCameraComponent(const CS::CameraComponentSPtr& in_cameraComponent)
+    {
+        m_cameraComponent = in_cameraComponent;
+    }
+    //----------------------------------------------------------
+    //----------------------------------------------------------
+    void TouchControllerComponent::Reset()
+    {
+        m_cameraComponent.reset();
+        m_targetPos = CS::Vector3::k_zero;
+        m_currentSpeed = 0.0f;
+    }
     //----------------------------------------------------
     //----------------------------------------------------
     void TouchControllerComponent::OnAddedToScene()
@@ -77,6 +91,8 @@ namespace CSPong
     //----------------------------------------------------
     void TouchControllerComponent::UpdateTargetPosition(const CS::Vector2& in_screenPos)
     {
+        CS_ASSERT(m_cameraComponent != nullptr, "Touch controller needs a camera.");
+        
         CS::Ray worldRay = m_cameraComponent->Unproject(in_screenPos);
         
         f32 distanceToGroundPlace = -worldRay.vOrigin.z / worldRay.vDirection.z;
@@ -98,7 +114,7 @@ namespace CSPong
     //----------------------------------------------------
     void TouchControllerComponent::OnFixedUpdate(f32 in_timeSinceLastUpdate)
     {
-        CS::Vector3 currentPos(GetEntity()->GetTransform().GetWorldPosition());
+        CS::Vector3 currentPos(m_body->GetPosition(), 0.0f);
         CS::Vector3 direction(m_targetPos - currentPos);
         
         m_body->ApplyImpulse(CS::Vector2(0.0f, direction.y) * k_maxForce * in_timeSinceLastUpdate);
@@ -66,6 +66,16 @@ namespace CSPong
         /// @return Whether the class matches the comparison type
         //----------------------------------------------------------
         bool IsA(CS::InterfaceIDType in_interfaceId) const override;
+        //----------------------------------------------------------
+        /// @param The camera used to convert pointer positions
+        /// into world space.
+        //----------------------------------------------------------
+        void SetCameraComponent(const CS::CameraComponentSPtr& in_cameraComponent);
+        //----------------------------------------------------------
+        /// Clears the target position and the camera. Used when
+        /// the paddle is released back to its pool.
+        //----------------------------------------------------------
+        void Reset();
         
     private:
         
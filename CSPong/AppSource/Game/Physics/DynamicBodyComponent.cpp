@@ -34,8 +34,17 @@
 
 #include <ChilliSource/Core/Entity.h>
 
+#include <cmath>
+
 namespace CSPong
 {
+    namespace
+    {
+        //The impulse and drag values were tuned against a 60 Hz step. They
+        //are scaled by this so the physics behaves the same at any step rate.
+        const f32 k_referenceTimeStep = 1.0f / 60.0f;
+    }
+    
     CS_DEFINE_NAMEDTYPE(DynamicBodyComponent);
     //----------------------------------------------------------
     //----------------------------------------------------------
@@ -63,6 +72,13 @@ namespace CSPong
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
+    void DynamicBodyComponent::Reset()
+    {
+        m_impulse = CS::Vector2::k_zero;
+        m_velocity = CS::Vector2::k_zero;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
     const CS::Vector2& DynamicBodyComponent::GetSize() const
     {
         return m_size;
@@ -81,6 +97,25 @@ namespace CSPong
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
+    void DynamicBodyComponent::SetPosition(const CS::Vector2& in_position)
+    {
+        m_position = in_position;
+        m_previousPosition = in_position;
+        
+        if (GetEntity() != nullptr)
+        {
+            CS::Vector3 entityPosition = GetEntity()->GetTransform().GetLocalPosition();
+            GetEntity()->GetTransform().SetPosition(in_position.x, in_position.y, entityPosition.z);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    const CS::Vector2& DynamicBodyComponent::GetPosition() const
+    {
+        return m_position;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
     CS::IConnectableEvent<DynamicBodyComponent::CollisionDelegate>& DynamicBodyComponent::GetCollisionEvent()
     {
         return m_collisionEvent;
@@ -95,22 +130,31 @@ namespace CSPong
     //------------------------------------------------------------
     void DynamicBodyComponent::OnAddedToScene()
     {
+        m_position = GetEntity()->GetTransform().GetWorldPosition().XY();
+        m_previousPosition = m_position;
+        
         m_physicsSystem->RegisterDynamicBody(this);
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
     void DynamicBodyComponent::OnPhysicsUpdate(f32 in_deltaTime)
     {
+        m_previousPosition = m_position;
+        
         CS::Vector2 accceleration = m_impulse / m_mass;
         m_impulse = CS::Vector2::k_zero;
-        m_velocity += accceleration * in_deltaTime;
-        m_velocity *= (1.0f - m_dragFactor);
-        CS::Vector2 displacement = m_velocity * in_deltaTime;
-        
-        CS::Vector3 currentPosition = GetEntity()->GetTransform().GetWorldPosition();
-        CS::Vector3 newPosition(currentPosition.x + displacement.x, currentPosition.y + displacement.y, currentPosition.z);
+        m_velocity += accceleration * k_referenceTimeStep;
+        m_velocity *= std::pow(1.0f - m_dragFactor, in_deltaTime / k_referenceTimeStep);
+        m_position += m_velocity * in_deltaTime;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void DynamicBodyComponent::OnInterpolate(f32 in_alpha)
+    {
+        CS::Vector2 position = m_previousPosition + (m_position - m_previousPosition) * in_alpha;
         
-        GetEntity()->GetTransform().SetPosition(newPosition);
+        CS::Vector3 entityPosition = GetEntity()->GetTransform().GetLocalPosition();
+        GetEntity()->GetTransform().SetPosition(position.x, position.y, entityPosition.z);
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
@@ -118,8 +162,7 @@ namespace CSPong
     {
         f32 collisionShare = in_collidedWith->GetMass() / (GetMass() + in_collidedWith->GetMass());
         
-        CS::Vector2 displacement = in_intersectionResolution * collisionShare;
-        GetEntity()->GetTransform().MoveBy(displacement.x, displacement.y, 0.0f);
+        m_position += in_intersectionResolution * collisionShare;
         
         CS::Vector2 velocityChange = collisionShare * ((1.0f + m_coefficientOfRestitution) * in_collisionDirection * CS::Vector2::DotProduct(m_velocity, in_collisionDirection));
         m_velocity -= velocityChange;
@@ -130,7 +173,7 @@ namespace CSPong
     //------------------------------------------------------------
     void DynamicBodyComponent::OnStaticCollision(const CS::Vector2& in_collisionDirection, const CS::Vector2& in_intersectionResolution, StaticBodyComponent* in_collidedWith)
     {
-        GetEntity()->GetTransform().MoveBy(in_intersectionResolution.x, in_intersectionResolution.y, 0.0f);
+        m_position += in_intersectionResolution;
         
         CS::Vector2 velocityChange = (1.0f + m_coefficientOfRestitution) * in_collisionDirection * CS::Vector2::DotProduct(m_velocity, in_collisionDirection);
         m_velocity -= velocityChange;
@@ -112,6 +112,11 @@ namespace CSPong
         //------------------------------------------------------------
         void SetVelocity(const CS::Vector2& in_velocity);
         //------------------------------------------------------------
+        /// Clears the velocity and any pending impulse so that the
+        /// body is at rest.
+        //------------------------------------------------------------
+        void Reset();
+        //------------------------------------------------------------
         /// @author Ian Copland
         ///
         /// @return The size of the physics body.
@@ -130,6 +135,22 @@ namespace CSPong
         //------------------------------------------------------------
         const CS::Vector2& GetVelocity() const;
         //------------------------------------------------------------
+        /// Moves the physics body immediately, without interpolating
+        /// from its previous position. Use this rather than setting
+        /// the entity position while the body is in the scene, as
+        /// the entity position is overwritten with the interpolated
+        /// physics position every frame.
+        ///
+        /// @param The new position.
+        //------------------------------------------------------------
+        void SetPosition(const CS::Vector2& in_position);
+        //------------------------------------------------------------
+        /// @return The position of the physics body as of the latest
+        /// physics step. This can be ahead of the rendered entity
+        /// position by up to one step.
+        //------------------------------------------------------------
+        const CS::Vector2& GetPosition() const;
+        //------------------------------------------------------------
         /// @author Ian Copland
         ///
         /// @param An event that can be listened to in order to receive
@@ -151,7 +172,8 @@ namespace CSPong
         /// either when its owner entity is added to the scene or when
         /// attached an an entity that is already in the scene. This will
         /// register the dynamic body with the physics system so that it
-        /// can receive physics updates.
+        /// can receive physics updates. The physics position is taken
+        /// from the entity.
         ///
         /// @author Ian Copland
         ///
@@ -164,9 +186,20 @@ namespace CSPong
         /// the currently accumulated impulse to the dynamic body.
         ///
         /// @author Ian Copland
+        ///
+        /// @param The fixed time between physics frames.
         //------------------------------------------------------------
         void OnPhysicsUpdate(f32 in_deltaTime);
         //------------------------------------------------------------
+        /// Called by the physics system every frame after any
+        /// physics steps. Positions the entity between the previous
+        /// and current physics positions.
+        ///
+        /// @param How far between the previous and the current
+        /// physics step the frame falls, in the range [0, 1].
+        //------------------------------------------------------------
+        void OnInterpolate(f32 in_alpha);
+        //------------------------------------------------------------
         /// Called when the dynamic body collides with another dynamic
         /// body. This will resolve the collision by moving the body
         /// such that it is no longer in collision and will update the
@@ -227,6 +260,8 @@ namespace CSPong
         const f32 m_coefficientOfRestitution;
         CS::Vector2 m_impulse;
         CS::Vector2 m_velocity;
+        CS::Vector2 m_position;
+        CS::Vector2 m_previousPosition;
         CS::Event<CollisionDelegate> m_collisionEvent;
         CS::Event<TriggerDelegate> m_triggerEvent;
     };
@@ -35,6 +35,12 @@
 #include <ChilliSource/Core/Entity.h>
 #include <ChilliSource/Core/Math.h>
 
+#include <algorithm>
+
+#if defined(CSPONG_STRESS_TEST) || defined(CSPONG_STRESS_BENCHMARK)
+#include <chrono>
+#endif
+
 namespace CSPong
 {
     namespace
@@ -65,11 +71,8 @@ namespace CSPong
         //---------------------------------------------------------
         bool TestCollision(const DynamicBodyComponent* in_bodyA, const DynamicBodyComponent* in_bodyB, CollisionResolution& out_resolution)
         {
-            const CS::Entity* entityA = in_bodyA->GetEntity();
-            const CS::Entity* entityB = in_bodyB->GetEntity();
-            
-            const CS::Rectangle rectA(entityA->GetTransform().GetWorldPosition().XY(), in_bodyA->GetSize());
-            const CS::Rectangle rectB(entityB->GetTransform().GetWorldPosition().XY(), in_bodyB->GetSize());
+            const CS::Rectangle rectA(in_bodyA->GetPosition(), in_bodyA->GetSize());
+            const CS::Rectangle rectB(in_bodyB->GetPosition(), in_bodyB->GetSize());
             
             if (rectA.Left() < rectB.Right() && rectA.Right() > rectB.Left() && rectA.Bottom() < rectB.Top() && rectA.Top() > rectB.Bottom())
             {
@@ -127,10 +130,9 @@ namespace CSPong
         //---------------------------------------------------------
         bool TestCollision(const DynamicBodyComponent* in_dynamic, const StaticBodyComponent* in_static, CollisionResolution& out_resolution)
         {
-            const CS::Entity* dynamicEnt = in_dynamic->GetEntity();
             const CS::Entity* staticEnt = in_static->GetEntity();
             
-            const CS::Rectangle dynamicRect(dynamicEnt->GetTransform().GetWorldPosition().XY(), in_dynamic->GetSize());
+            const CS::Rectangle dynamicRect(in_dynamic->GetPosition(), in_dynamic->GetSize());
             const CS::Rectangle staticRect(staticEnt->GetTransform().GetWorldPosition().XY(), in_static->GetSize());
             
             if (dynamicRect.Left() < staticRect.Right() && dynamicRect.Right() > staticRect.Left() && dynamicRect.Bottom() < staticRect.Top() && dynamicRect.Top() > staticRect.Bottom())
@@ -185,10 +187,9 @@ namespace CSPong
         //---------------------------------------------------------
         bool TestCollision(const DynamicBodyComponent* in_dynamic, const TriggerComponent* in_static)
         {
-            const CS::Entity* dynamicEnt = in_dynamic->GetEntity();
             const CS::Entity* staticEnt = in_static->GetEntity();
             
-            CS::Rectangle dynamicRect(dynamicEnt->GetTransform().GetWorldPosition().XY(), in_dynamic->GetSize());
+            CS::Rectangle dynamicRect(in_dynamic->GetPosition(), in_dynamic->GetSize());
             CS::Rectangle staticRect(staticEnt->GetTransform().GetWorldPosition().XY(), in_static->GetSize());
             if (dynamicRect.Left() < staticRect.Right() && dynamicRect.Right() > staticRect.Left() && dynamicRect.Bottom() < staticRect.Top() && dynamicRect.Top() > staticRect.Bottom())
             {
@@ -199,6 +200,12 @@ namespace CSPong
         }
     }
     
+    namespace
+    {
+        const f32 k_stepInterval = 1.0f / 30.0f;
+        const u32 k_maxStepsPerFrame = 4;
+    }
+    
     CS_DEFINE_NAMEDTYPE(PhysicsSystem);
     //---------------------------------------------------
     //---------------------------------------------------
@@ -214,6 +221,18 @@ namespace CSPong
     }
     //----------------------------------------------------------
     //----------------------------------------------------------
+    const PhysicsSystem::StepStats& PhysicsSystem::GetStepStats() const
+    {
+        return m_stepStats;
+    }
+    //----------------------------------------------------------
+    //----------------------------------------------------------
+    void PhysicsSystem::ResetStepStats()
+    {
+        m_stepStats = StepStats();
+    }
+    //----------------------------------------------------------
+    //----------------------------------------------------------
     void PhysicsSystem::RegisterDynamicBody(DynamicBodyComponent* in_dynamicBody)
     {
         m_dynamicBodies.push_back(in_dynamicBody);
@@ -283,14 +302,44 @@ namespace CSPong
     }
     //----------------------------------------------------------
     //----------------------------------------------------------
-    void PhysicsSystem::OnFixedUpdate(f32 in_deltaTime)
+    void PhysicsSystem::OnUpdate(f32 in_timeSinceLastUpdate)
+    {
+        //Drop any time beyond the step cap rather than falling further behind.
+        m_stepAccumulator = std::min(m_stepAccumulator + in_timeSinceLastUpdate, k_stepInterval * k_maxStepsPerFrame);
+        
+        while (m_stepAccumulator >= k_stepInterval)
+        {
+            m_stepAccumulator -= k_stepInterval;
+            Step(k_stepInterval);
+        }
+        
+        f32 alpha = m_stepAccumulator / k_stepInterval;
+        for (auto& dynamicBody : m_dynamicBodies)
+        {
+            dynamicBody->OnInterpolate(alpha);
+        }
+    }
+    //----------------------------------------------------------
+    //----------------------------------------------------------
+    void PhysicsSystem::Step(f32 in_deltaTime)
     {
+#if defined(CSPONG_STRESS_TEST) || defined(CSPONG_STRESS_BENCHMARK)
+        auto stepStart = std::chrono::steady_clock::now();
+#endif
+        
         for (auto& dynamicBody : m_dynamicBodies)
         {
             dynamicBody->OnPhysicsUpdate(in_deltaTime);
         }
         
         ResolveCollisions();
+        
+#if defined(CSPONG_STRESS_TEST) || defined(CSPONG_STRESS_BENCHMARK)
+        f64 stepSeconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() - stepStart).count();
+        m_stepStats.m_numSteps++;
+        m_stepStats.m_totalSeconds += stepSeconds;
+        m_stepStats.m_maxSeconds = std::max(m_stepStats.m_maxSeconds, stepSeconds);
+#endif
     }
     //----------------------------------------------------------
     //----------------------------------------------------------
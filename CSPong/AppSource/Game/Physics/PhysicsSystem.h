@@ -41,6 +41,13 @@ namespace CSPong
     /// and performing collision checks between static and
     /// dynamic bodies.
     ///
+    /// Physics is stepped at its own fixed rate, independent of
+    /// the frame rate and the application fixed update rate.
+    /// Every frame the dynamic body entities are positioned
+    /// between their previous and current physics states by the
+    /// fraction of a step left in the accumulator, so motion
+    /// renders smoothly at any display rate.
+    ///
     /// @author S Downie
     //------------------------------------------------------------
     class PhysicsSystem final : public CS::StateSystem
@@ -64,6 +71,27 @@ namespace CSPong
         /// @return Whether the class matches the comparison type
         //----------------------------------------------------------
         bool IsA(CS::InterfaceIDType in_interfaceId) const override;
+        //----------------------------------------------------------
+        /// Timings of the fixed physics steps since the stats were
+        /// last reset. Only the stress test reads these, so they are
+        /// only recorded when CSPONG_STRESS_TEST or
+        /// CSPONG_STRESS_BENCHMARK is defined and otherwise stay
+        /// zero.
+        //----------------------------------------------------------
+        struct StepStats
+        {
+            u32 m_numSteps = 0;
+            f64 m_totalSeconds = 0.0;
+            f64 m_maxSeconds = 0.0;
+        };
+        //----------------------------------------------------------
+        /// @return The fixed step timings.
+        //----------------------------------------------------------
+        const StepStats& GetStepStats() const;
+        //----------------------------------------------------------
+        /// Clears the fixed step timings.
+        //----------------------------------------------------------
+        void ResetStepStats();
     private:
         friend class DynamicBodyComponent;
         friend class StaticBodyComponent;
@@ -131,15 +159,22 @@ namespace CSPong
         //----------------------------------------------------------
         void DeregisterTrigger(TriggerComponent* in_trigger);
         //----------------------------------------------------------
-        /// Called every fixed update frame. This will call physics
+        /// Called every frame. This runs as many physics steps as
+        /// have accumulated then interpolates the dynamic bodies.
+        ///
+        /// @param The time since the last frame.
+        //----------------------------------------------------------
+        void OnUpdate(f32 in_timeSinceLastUpdate) override;
+        //----------------------------------------------------------
+        /// Performs a single physics step. This will call physics
         /// update on all dynamic bodies and perform collision
         /// checks.
         ///
         /// @author Ian Copland
         ///
-        /// @param The fixed time since last update.
+        /// @param The fixed time step.
         //----------------------------------------------------------
-        void OnFixedUpdate(f32 in_deltaTime) override;
+        void Step(f32 in_deltaTime);
         //----------------------------------------------------------
         /// Performs collision tests on all dynamic bodies against
         /// other dynamic bodies and static bodies. If any are in
@@ -152,6 +187,9 @@ namespace CSPong
         std::vector<DynamicBodyComponent*> m_dynamicBodies;
         std::vector<StaticBodyComponent*> m_staticBodies;
         std::vector<TriggerComponent*> m_triggers;
+        
+        StepStats m_stepStats;
+        f32 m_stepAccumulator = 0.0f;
     };
 }
 
@@ -75,22 +75,22 @@ namespace CSPong
         const f32 k_paddingFromCentre = 10.0f;
         
         CS::EntitySPtr player1TensEntity = entityFactory->CreateScoreSprite(k_digitSize, CS::AlignmentAnchor::k_middleRight);
-        m_scoreViews[0].first = player1TensEntity->GetComponent<CS::SpriteComponent>();
+        m_scoreViews[0].first = DigitSpriteBinding(player1TensEntity->GetComponent<CS::SpriteComponent>(), 0);
         player1TensEntity->GetTransform().SetPosition(-k_paddingFromCentre - k_digitSize.x, 0.0f, distanceFromGround);
         scene->Add(player1TensEntity);
         
         CS::EntitySPtr player1SinglesEntity = entityFactory->CreateScoreSprite(k_digitSize, CS::AlignmentAnchor::k_middleRight);
-        m_scoreViews[0].second = player1SinglesEntity->GetComponent<CS::SpriteComponent>();
+        m_scoreViews[0].second = DigitSpriteBinding(player1SinglesEntity->GetComponent<CS::SpriteComponent>(), 0);
         player1SinglesEntity->GetTransform().SetPosition(-k_paddingFromCentre, 0.0f, distanceFromGround);
         scene->Add(player1SinglesEntity);
 
         CS::EntitySPtr player2TensEntity = entityFactory->CreateScoreSprite(k_digitSize, CS::AlignmentAnchor::k_middleLeft);
-        m_scoreViews[1].first = player2TensEntity->GetComponent<CS::SpriteComponent>();
+        m_scoreViews[1].first = DigitSpriteBinding(player2TensEntity->GetComponent<CS::SpriteComponent>(), 0);
         player2TensEntity->GetTransform().SetPosition(k_paddingFromCentre, 0.0f, distanceFromGround);
         scene->Add(player2TensEntity);
         
         CS::EntitySPtr player2SinglesEntity = entityFactory->CreateScoreSprite(k_digitSize, CS::AlignmentAnchor::k_middleLeft);
-        m_scoreViews[1].second = player2SinglesEntity->GetComponent<CS::SpriteComponent>();
+        m_scoreViews[1].second = DigitSpriteBinding(player2SinglesEntity->GetComponent<CS::SpriteComponent>(), 0);
         player2SinglesEntity->GetTransform().SetPosition(k_paddingFromCentre + k_digitSize.x, 0.0f, distanceFromGround);
         scene->Add(player2SinglesEntity);
     }
@@ -98,7 +98,11 @@ namespace CSPong
     //------------------------------------------------
     void ScoringSystem::AddBallBody(const DynamicBodyComponentSPtr& in_body)
     {
-        m_ballTriggerConnections.push_back(in_body->GetTriggerEvent().OpenConnection(CS::MakeDelegate(this, &ScoringSystem::OnBallHitTrigger)));
+        DynamicBodyComponent* body = in_body.get();
+        m_ballTriggerConnections.push_back(in_body->GetTriggerEvent().OpenConnection([this, body](CS::Entity* in_trigger)
+        {
+            OnBallHitTrigger(body->GetEntity(), in_trigger);
+        }));
     }
     //------------------------------------------------
     //------------------------------------------------
@@ -110,13 +114,14 @@ namespace CSPong
     }
     //------------------------------------------------
     //------------------------------------------------
-    void ScoringSystem::OnBallHitTrigger(CS::Entity* in_trigger)
+    void ScoringSystem::OnBallHitTrigger(CS::Entity* in_ball, CS::Entity* in_trigger)
     {
         for(u32 i=0; i<m_goaltriggers.size(); ++i)
         {
             if(m_goaltriggers[i] == in_trigger)
             {
                 IncrementScore(i);
+                m_ballScoredEvent.NotifyConnections(in_ball, i);
                 return;
             }
         }
@@ -132,12 +137,12 @@ namespace CSPong
         if(m_scores[in_playerIndex] <= 99)
         {
             u32 tens = m_scores[in_playerIndex]/10;
-            m_scoreViews[in_playerIndex].first->SetTextureAtlasId(CS::ToString(tens));
+            m_scoreViews[in_playerIndex].first.SetDigit(tens);
             
             u32 singles = m_scores[in_playerIndex]%10;
-            m_scoreViews[in_playerIndex].second->SetTextureAtlasId(CS::ToString(singles));
+            m_scoreViews[in_playerIndex].second.SetDigit(singles);
         }
-        else
+        else if(m_scores[in_playerIndex] == 100)
         {
             CS_LOG_WARNING("We can only currently display scores up to 99");
         }
@@ -150,4 +155,10 @@ namespace CSPong
     {
         return m_scoreChangedEvent;
     }
+    //----------------------------------------------------
+    //----------------------------------------------------
+    CS::IConnectableEvent<ScoringSystem::BallScoredDelegate>& ScoringSystem::GetBallScoredEvent()
+    {
+        return m_ballScoredEvent;
+    }
 }
@@ -34,6 +34,8 @@
 #include <ChilliSource/Core/Event.h>
 #include <ChilliSource/Core/System.h>
 
+#include <Game/DigitSpriteBinding.h>
+
 #include <array>
 #include <functional>
 #include <vector>
@@ -64,6 +66,15 @@ namespace CSPong
         /// @param Array of the current scores
         //----------------------------------------------------
         using ScoreChangedDelegate = std::function<void(const Scores&)>;
+        //----------------------------------------------------
+        /// A delegate that is used to receive events whenever
+        /// a ball enters a goal, identifying the ball. This is
+        /// sent after the score changed event.
+        ///
+        /// @param The ball entity.
+        /// @param The index of the player that scored.
+        //----------------------------------------------------
+        using BallScoredDelegate = std::function<void(CS::Entity*, u32)>;
         //---------------------------------------------------
         /// Creates a new instance of the system.
         ///
@@ -86,6 +97,10 @@ namespace CSPong
         /// @return The score changed event.
         //----------------------------------------------------
         CS::IConnectableEvent<ScoreChangedDelegate>& GetScoreChangedEvent();
+        //----------------------------------------------------
+        /// @return The ball scored event.
+        //----------------------------------------------------
+        CS::IConnectableEvent<BallScoredDelegate>& GetBallScoredEvent();
         //------------------------------------------------
         /// Add a ball body which will be checked against
         /// the goal triggers to detect if a goal has been
@@ -127,8 +142,11 @@ namespace CSPong
         /// to see if the score should be increased.
         ///
         /// @author S Downie
+        ///
+        /// @param The ball entity.
+        /// @param The trigger entity.
         //------------------------------------------------
-        void OnBallHitTrigger(CS::Entity* in_trigger);
+        void OnBallHitTrigger(CS::Entity* in_ball, CS::Entity* in_trigger);
         //------------------------------------------------
         /// Increment the score for the player at
         /// the given index by 1.
@@ -142,10 +160,11 @@ namespace CSPong
     private:
         
         CS::Event<ScoreChangedDelegate> m_scoreChangedEvent;
+        CS::Event<BallScoredDelegate> m_ballScoredEvent;
         
         Scores m_scores;
         
-        std::array<std::pair<CS::SpriteComponentSPtr, CS::SpriteComponentSPtr>, k_numPlayers> m_scoreViews;
+        std::array<std::pair<DigitSpriteBinding, DigitSpriteBinding>, k_numPlayers> m_scoreViews;
         std::vector<CS::EventConnectionUPtr> m_ballTriggerConnections;
         std::array<CS::Entity*, k_numPlayers> m_goaltriggers;
     };
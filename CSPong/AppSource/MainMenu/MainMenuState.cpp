@@ -29,7 +29,9 @@
 #include <MainMenu/MainMenuState.h>
 
 #include <Common/TransitionSystem.h>
+#include <Common/TweenSystem.h>
 #include <Game/GameState.h>
+#include <Stress/StressState.h>
 
 #include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Resource.h>
@@ -43,7 +45,8 @@ namespace CSPong
     //------------------------------------------------------
     void MainMenuState::CreateSystems()
     {
-        m_transitionSystem = CreateSystem<TransitionSystem>(1.0f, 1.0f);
+        auto tweenSystem = CreateSystem<TweenSystem>();
+        m_transitionSystem = CreateSystem<TransitionSystem>(tweenSystem, 1.0f, 1.0f);
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
@@ -130,7 +133,11 @@ namespace CSPong
             m_playButtonTween.Play(CS::TweenPlayMode::k_onceReverse);
             m_playButtonTween.SetOnEndDelegate([this](CS::EaseInOutBackTween<f32>* in_tween)
             {
+#ifdef CSPONG_STRESS_TEST
+                m_transitionSystem->Transition(CS::StateSPtr(new StressState(StressState::Mode::k_rendered)));
+#else
                 m_transitionSystem->Transition(CS::StateSPtr(new GameState()));
+#endif
             });
         });
         
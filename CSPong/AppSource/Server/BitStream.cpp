@@ -0,0 +1,125 @@
+//
+//  BitStream.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/BitStream.h>
+
+#include <ChilliSource/Core/Base.h>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    BitWriter::BitWriter(u8* in_buffer, u32 in_bufferSize)
+    : m_buffer(in_buffer), m_bufferSize(in_bufferSize)
+    {
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void BitWriter::Write(u32 in_value, u32 in_numBits)
+    {
+        CS_ASSERT(in_numBits <= 32, "Cannot write more than 32 bits at once.");
+
+        u64 mask = (u64(1) << in_numBits) - 1;
+        m_scratch |= (u64(in_value) & mask) << m_scratchBits;
+        m_scratchBits += in_numBits;
+
+        while (m_scratchBits >= 8)
+        {
+            if (m_size < m_bufferSize)
+            {
+                m_buffer[m_size++] = u8(m_scratch & 0xff);
+            }
+            else
+            {
+                m_overflowed = true;
+            }
+
+            m_scratch >>= 8;
+            m_scratchBits -= 8;
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void BitWriter::Flush()
+    {
+        if (m_scratchBits > 0)
+        {
+            Write(0, 8 - m_scratchBits);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 BitWriter::GetSize() const
+    {
+        return m_size;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    bool BitWriter::HasOverflowed() const
+    {
+        return m_overflowed;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    BitReader::BitReader(const u8* in_buffer, u32 in_bufferSize)
+    : m_buffer(in_buffer), m_bufferSize(in_bufferSize)
+    {
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 BitReader::Read(u32 in_numBits)
+    {
+        CS_ASSERT(in_numBits <= 32, "Cannot read more than 32 bits at once.");
+
+        while (m_scratchBits < in_numBits)
+        {
+            if (m_position < m_bufferSize)
+            {
+                m_scratch |= u64(m_buffer[m_position++]) << m_scratchBits;
+            }
+            else
+            {
+                m_overflowed = true;
+            }
+
+            m_scratchBits += 8;
+        }
+
+        u64 mask = (u64(1) << in_numBits) - 1;
+        u32 value = u32(m_scratch & mask);
+        m_scratch >>= in_numBits;
+        m_scratchBits -= in_numBits;
+        return value;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    bool BitReader::HasOverflowed() const
+    {
+        return m_overflowed;
+    }
+}
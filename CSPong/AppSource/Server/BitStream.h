@@ -0,0 +1,110 @@
+//
+//  BitStream.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_BITSTREAM_H_
+#define _APPSOURCE_SERVER_BITSTREAM_H_
+
+#include <ForwardDeclarations.h>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// Packs values of arbitrary bit width into a byte buffer,
+    /// least significant bit first.
+    //------------------------------------------------------------
+    class BitWriter final
+    {
+    public:
+        //------------------------------------------------------------
+        /// @param The buffer to write into.
+        /// @param The size of the buffer in bytes.
+        //------------------------------------------------------------
+        BitWriter(u8* in_buffer, u32 in_bufferSize);
+        //------------------------------------------------------------
+        /// Appends the low bits of a value.
+        ///
+        /// @param The value.
+        /// @param The number of bits to write, up to 32.
+        //------------------------------------------------------------
+        void Write(u32 in_value, u32 in_numBits);
+        //------------------------------------------------------------
+        /// Writes any partially filled byte to the buffer.
+        //------------------------------------------------------------
+        void Flush();
+        //------------------------------------------------------------
+        /// @return The number of whole bytes used, including any
+        /// partial byte once flushed.
+        //------------------------------------------------------------
+        u32 GetSize() const;
+        //------------------------------------------------------------
+        /// @return Whether a write ran past the end of the buffer.
+        //------------------------------------------------------------
+        bool HasOverflowed() const;
+
+    private:
+        u8* m_buffer;
+        u32 m_bufferSize;
+        u32 m_size = 0;
+        u64 m_scratch = 0;
+        u32 m_scratchBits = 0;
+        bool m_overflowed = false;
+    };
+    //------------------------------------------------------------
+    /// Reads values written by a BitWriter.
+    //------------------------------------------------------------
+    class BitReader final
+    {
+    public:
+        //------------------------------------------------------------
+        /// @param The buffer to read from.
+        /// @param The size of the buffer in bytes.
+        //------------------------------------------------------------
+        BitReader(const u8* in_buffer, u32 in_bufferSize);
+        //------------------------------------------------------------
+        /// @param The number of bits to read, up to 32.
+        ///
+        /// @return The value read. Reading past the end of the
+        /// buffer yields zeros and marks the reader as overflowed.
+        //------------------------------------------------------------
+        u32 Read(u32 in_numBits);
+        //------------------------------------------------------------
+        /// @return Whether a read ran past the end of the buffer.
+        //------------------------------------------------------------
+        bool HasOverflowed() const;
+
+    private:
+        const u8* m_buffer;
+        u32 m_bufferSize;
+        u32 m_position = 0;
+        u64 m_scratch = 0;
+        u32 m_scratchBits = 0;
+        bool m_overflowed = false;
+    };
+}
+
+#endif
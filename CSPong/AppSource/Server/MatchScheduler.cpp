@@ -0,0 +1,315 @@
+//
+//  MatchScheduler.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/MatchScheduler.h>
+
+#include <Server/MatchSimulation.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace CSPong
+{
+    namespace
+    {
+        const u32 k_matchesPerChunk = 16;
+        const u32 k_maxCatchUpTicks = 4;
+        const f32 k_backpressureSmoothing = 0.1f;
+        
+        //------------------------------------------------------------
+        /// @param The first chunk in the range.
+        /// @param One past the last chunk in the range.
+        ///
+        /// @return The range packed into a worker queue value.
+        //------------------------------------------------------------
+        u64 PackRange(u32 in_begin, u32 in_end)
+        {
+            return (u64(in_begin) << 32) | u64(in_end);
+        }
+    }
+
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    MatchScheduler::MatchScheduler(u32 in_tickRate)
+    : m_tickInterval(1.0f / f32(in_tickRate)), m_batchInFlight(false), m_workersRemaining(0), m_batchTicks(0), m_batchLateTicks(0)
+    {
+        CS_ASSERT(in_tickRate > 0, "Tick rate must be greater than zero.");
+
+        m_numWorkers = std::max(1u, std::thread::hardware_concurrency());
+        m_workerQueues.reset(new WorkerQueue[m_numWorkers]);
+        for (u32 i = 0; i < m_numWorkers; ++i)
+        {
+            m_workerQueues[i].m_range = 0;
+        }
+        m_lastBatchTime = std::chrono::steady_clock::now();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    MatchScheduler::~MatchScheduler()
+    {
+        while (m_batchInFlight == true)
+        {
+            std::this_thread::yield();
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 MatchScheduler::AddMatch(MatchSimulationUPtr in_match)
+    {
+        CS_ASSERT(in_match != nullptr, "Cannot schedule a null match.");
+
+        u32 matchId = u32(m_matches.size() + m_pendingMatches.size());
+        m_pendingMatches.push_back(std::move(in_match));
+        return matchId;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    MatchSimulation* MatchScheduler::GetMatch(u32 in_matchId) const
+    {
+        if (in_matchId < m_matches.size())
+        {
+            return m_matches[in_matchId].m_match.get();
+        }
+
+        return nullptr;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 MatchScheduler::GetNumMatches() const
+    {
+        return u32(m_matches.size());
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 MatchScheduler::GetNumWorkers() const
+    {
+        return m_numWorkers;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    bool MatchScheduler::IsBatchInFlight() const
+    {
+        return m_batchInFlight;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchScheduler::Update()
+    {
+        if (m_batchInFlight == true)
+        {
+            return;
+        }
+
+        //Gather the results of the last batch.
+        u32 ticks = m_batchTicks.exchange(0);
+        u32 lateTicks = m_batchLateTicks.exchange(0);
+        if (ticks > 0)
+        {
+            m_totalTicks += ticks;
+            f32 lateFraction = std::min(f32(lateTicks) / f32(ticks), 1.0f);
+            m_backpressure += (lateFraction - m_backpressure) * k_backpressureSmoothing;
+        }
+
+        //Matches can only join while no worker is reading the schedule.
+        for (auto& match : m_pendingMatches)
+        {
+            MatchSlot slot;
+            slot.m_match = std::move(match);
+            m_matches.push_back(std::move(slot));
+        }
+        m_pendingMatches.clear();
+
+        auto now = std::chrono::steady_clock::now();
+        m_batchDeltaTime = std::chrono::duration<f32>(now - m_lastBatchTime).count();
+        m_lastBatchTime = now;
+
+        if (m_matches.empty() == true)
+        {
+            return;
+        }
+
+        m_numChunks = (u32(m_matches.size()) + k_matchesPerChunk - 1) / k_matchesPerChunk;
+        m_numTasks = std::min(m_numWorkers, m_numChunks);
+
+        //Every worker starts with an even, contiguous share of the chunks.
+        for (u32 i = 0; i < m_numTasks; ++i)
+        {
+            u32 begin = u32(u64(m_numChunks) * i / m_numTasks);
+            u32 end = u32(u64(m_numChunks) * (i + 1) / m_numTasks);
+            m_workerQueues[i].m_range = PackRange(begin, end);
+        }
+
+        m_workersRemaining = m_numTasks;
+        m_batchInFlight = true;
+
+        auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+        for (u32 i = 0; i < m_numTasks; ++i)
+        {
+            taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& in_taskContext)
+            {
+                ProcessChunks(i);
+            });
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    f32 MatchScheduler::GetBackpressure() const
+    {
+        return m_backpressure;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u64 MatchScheduler::GetTotalTicks() const
+    {
+        return m_totalTicks;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchScheduler::ProcessChunks(u32 in_workerIndex)
+    {
+        u32 ticks = 0;
+        u32 lateTicks = 0;
+
+        while (true)
+        {
+            u32 chunk = 0;
+            while (TryPopChunk(in_workerIndex, chunk) == true)
+            {
+                u32 begin = chunk * k_matchesPerChunk;
+                u32 end = std::min(begin + k_matchesPerChunk, u32(m_matches.size()));
+                for (u32 i = begin; i < end; ++i)
+                {
+                    TickMatch(m_matches[i], ticks, lateTicks);
+                }
+            }
+
+            //Only the owner adds to a queue, so once every other queue has been
+            //seen empty the remaining chunks are all being ticked by their owners.
+            bool stolen = false;
+            for (u32 i = 1; i < m_numTasks && stolen == false; ++i)
+            {
+                stolen = TrySteal((in_workerIndex + i) % m_numTasks, in_workerIndex);
+            }
+
+            if (stolen == false)
+            {
+                break;
+            }
+        }
+
+        m_batchTicks += ticks;
+        m_batchLateTicks += lateTicks;
+
+        if (m_workersRemaining.fetch_sub(1) == 1)
+        {
+            m_batchInFlight = false;
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    bool MatchScheduler::TryPopChunk(u32 in_workerIndex, u32& out_chunk)
+    {
+        auto& range = m_workerQueues[in_workerIndex].m_range;
+        u64 current = range.load();
+        while (true)
+        {
+            u32 begin = u32(current >> 32);
+            u32 end = u32(current);
+            if (begin >= end)
+            {
+                return false;
+            }
+
+            if (range.compare_exchange_weak(current, PackRange(begin + 1, end)) == true)
+            {
+                out_chunk = begin;
+                return true;
+            }
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    bool MatchScheduler::TrySteal(u32 in_victimIndex, u32 in_thiefIndex)
+    {
+        auto& range = m_workerQueues[in_victimIndex].m_range;
+        u64 current = range.load();
+        while (true)
+        {
+            u32 begin = u32(current >> 32);
+            u32 end = u32(current);
+            if (begin >= end)
+            {
+                return false;
+            }
+
+            u32 newEnd = end - (end - begin + 1) / 2;
+            if (range.compare_exchange_weak(current, PackRange(begin, newEnd)) == true)
+            {
+                //The thief's queue is empty, so no one else can be taking from it.
+                m_workerQueues[in_thiefIndex].m_range = PackRange(newEnd, end);
+                return true;
+            }
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchScheduler::TickMatch(MatchSlot& in_slot, u32& out_ticks, u32& out_lateTicks) const
+    {
+        in_slot.m_accumulator += m_batchDeltaTime;
+
+        //The oldest owed tick became due one interval after the accumulator started
+        //owing it. Any tick run more than a full interval after it was due is late.
+        u32 numTicks = 0;
+        u32 numLate = 0;
+        while (in_slot.m_accumulator >= m_tickInterval && numTicks < k_maxCatchUpTicks)
+        {
+            if (in_slot.m_accumulator - m_tickInterval > m_tickInterval)
+            {
+                ++numLate;
+            }
+
+            in_slot.m_match->Tick(m_tickInterval);
+            in_slot.m_accumulator -= m_tickInterval;
+            ++numTicks;
+        }
+
+        //Time still owed after the catch up limit is dropped and counted as late.
+        if (in_slot.m_accumulator >= m_tickInterval)
+        {
+            numLate += u32(in_slot.m_accumulator / m_tickInterval);
+            in_slot.m_accumulator = std::fmod(in_slot.m_accumulator, m_tickInterval);
+        }
+
+        out_ticks += numTicks;
+        out_lateTicks += numLate;
+    }
+}
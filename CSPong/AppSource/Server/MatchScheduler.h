@@ -0,0 +1,205 @@
+//
+//  MatchScheduler.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_MATCHSCHEDULER_H_
+#define _APPSOURCE_SERVER_MATCHSCHEDULER_H_
+
+#include <ForwardDeclarations.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// Ticks a large number of headless matches at a fixed rate
+    /// across all cores.
+    ///
+    /// Each update the matches are split into small chunks and
+    /// one task per core is scheduled with the engine task
+    /// scheduler. Every task starts with an even share of the
+    /// chunks in its own queue and takes them from the front.
+    /// Once its queue is empty it steals half of the remaining
+    /// chunks from the back of another task's queue, so a core
+    /// that finishes early takes work that would otherwise queue
+    /// behind a slow core, while the owner and thief rarely
+    /// touch the same end. As chunks are contiguous, each queue
+    /// is a range of chunk indices packed into one atomic.
+    /// The main thread never waits on the workers: if a batch is
+    /// still running when the next frame starts, the matches
+    /// simply accumulate more time and catch up with extra ticks
+    /// next batch, which is reported through the backpressure
+    /// metric.
+    //------------------------------------------------------------
+    class MatchScheduler final
+    {
+    public:
+        //------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @param The fixed tick rate of every match in Hz.
+        //------------------------------------------------------------
+        MatchScheduler(u32 in_tickRate);
+        //------------------------------------------------------------
+        /// Destructor. Blocks until any in flight batch has
+        /// finished so that no worker outlives the matches.
+        //------------------------------------------------------------
+        ~MatchScheduler();
+        //------------------------------------------------------------
+        /// Queues a match to be ticked. The match joins the
+        /// schedule at the start of the next batch.
+        ///
+        /// @param The match.
+        ///
+        /// @return The id of the match.
+        //------------------------------------------------------------
+        u32 AddMatch(MatchSimulationUPtr in_match);
+        //------------------------------------------------------------
+        /// @param The match id.
+        ///
+        /// @return The match with the given id or null if it has
+        /// not yet joined the schedule.
+        //------------------------------------------------------------
+        MatchSimulation* GetMatch(u32 in_matchId) const;
+        //------------------------------------------------------------
+        /// @return The number of scheduled matches.
+        //------------------------------------------------------------
+        u32 GetNumMatches() const;
+        //------------------------------------------------------------
+        /// @return The number of worker tasks used per batch.
+        //------------------------------------------------------------
+        u32 GetNumWorkers() const;
+        //------------------------------------------------------------
+        /// @return Whether a batch is currently being ticked. Match
+        /// state should only be read when this is false.
+        //------------------------------------------------------------
+        bool IsBatchInFlight() const;
+        //------------------------------------------------------------
+        /// Starts ticking the next batch if the previous one has
+        /// completed. Should be called once per frame from the
+        /// main thread.
+        //------------------------------------------------------------
+        void Update();
+        //------------------------------------------------------------
+        /// The backpressure metric is the smoothed fraction of
+        /// match ticks that ran later than their fixed schedule,
+        /// either because they had to catch up with more than one
+        /// tick in a batch or because time had to be dropped.
+        /// Zero means every match ticks on time.
+        ///
+        /// @return The backpressure in the range [0, 1].
+        //------------------------------------------------------------
+        f32 GetBackpressure() const;
+        //------------------------------------------------------------
+        /// @return The total number of ticks that have been run
+        /// across all matches.
+        //------------------------------------------------------------
+        u64 GetTotalTicks() const;
+
+    private:
+        //------------------------------------------------------------
+        /// A scheduled match and the time it has still to simulate.
+        //------------------------------------------------------------
+        struct MatchSlot
+        {
+            MatchSimulationUPtr m_match;
+            f32 m_accumulator = 0.0f;
+        };
+        //------------------------------------------------------------
+        /// A worker's queue of chunks: the range [begin, end) with
+        /// begin in the high and end in the low 32 bits. Padded
+        /// to a cache line so that workers do not contend on
+        /// each other's queues until they steal.
+        //------------------------------------------------------------
+        struct WorkerQueue
+        {
+            std::atomic<u64> m_range;
+            u8 m_padding[64 - sizeof(std::atomic<u64>)];
+        };
+        //------------------------------------------------------------
+        /// Ticks the chunks in the worker's own queue, then steals
+        /// from the other workers until there are none left to
+        /// steal. Run on each worker.
+        ///
+        /// @param The index of the worker.
+        //------------------------------------------------------------
+        void ProcessChunks(u32 in_workerIndex);
+        //------------------------------------------------------------
+        /// Takes the chunk at the front of the worker's queue.
+        ///
+        /// @param The index of the worker.
+        /// @param [Out] The chunk.
+        ///
+        /// @return Whether a chunk was taken.
+        //------------------------------------------------------------
+        bool TryPopChunk(u32 in_workerIndex, u32& out_chunk);
+        //------------------------------------------------------------
+        /// Moves half of the chunks remaining in the victim's
+        /// queue, rounded up, from its back into the thief's empty
+        /// queue.
+        ///
+        /// @param The index of the worker to steal from.
+        /// @param The index of the stealing worker.
+        ///
+        /// @return Whether any chunks were stolen.
+        //------------------------------------------------------------
+        bool TrySteal(u32 in_victimIndex, u32 in_thiefIndex);
+        //------------------------------------------------------------
+        /// Ticks every due step of a single match.
+        ///
+        /// @param The match slot.
+        /// @param [Out] Incremented by the ticks run.
+        /// @param [Out] Incremented by the ticks that ran late.
+        //------------------------------------------------------------
+        void TickMatch(MatchSlot& in_slot, u32& out_ticks, u32& out_lateTicks) const;
+
+        const f32 m_tickInterval;
+        u32 m_numWorkers;
+
+        std::vector<MatchSlot> m_matches;
+        std::vector<MatchSimulationUPtr> m_pendingMatches;
+
+        std::chrono::steady_clock::time_point m_lastBatchTime;
+        f32 m_batchDeltaTime = 0.0f;
+        u32 m_numChunks = 0;
+        u32 m_numTasks = 0;
+
+        std::unique_ptr<WorkerQueue[]> m_workerQueues;
+        std::atomic<bool> m_batchInFlight;
+        std::atomic<u32> m_workersRemaining;
+        std::atomic<u32> m_batchTicks;
+        std::atomic<u32> m_batchLateTicks;
+
+        f32 m_backpressure = 0.0f;
+        u64 m_totalTicks = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,263 @@
+//
+//  MatchServer.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/MatchServer.h>
+
+#include <Server/MatchScheduler.h>
+#include <Server/ServerProtocol.h>
+
+#include <ChilliSource/Core/Base.h>
+
+namespace CSPong
+{
+    namespace
+    {
+        //------------------------------------------------------------
+        /// Appends the position and velocity of a body to a packet.
+        ///
+        /// @param The packet writer.
+        /// @param The body.
+        //------------------------------------------------------------
+        void WriteBody(ServerProtocol::PacketWriter& in_writer, const MatchSimulation::Body& in_body)
+        {
+            in_writer.Write(in_body.m_position.x);
+            in_writer.Write(in_body.m_position.y);
+            in_writer.Write(in_body.m_velocity.x);
+            in_writer.Write(in_body.m_velocity.y);
+        }
+    }
+
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    MatchServer::MatchServer(MatchScheduler* in_scheduler, const MatchConfig& in_matchConfig, u16 in_port)
+    : m_scheduler(in_scheduler), m_matchConfig(in_matchConfig), m_spectatorBroadcaster(&m_socket)
+    {
+        CS_ASSERT(m_scheduler != nullptr, "Match server requires a scheduler.");
+
+        m_socket.Bind(in_port);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServer::Update()
+    {
+        ReceivePackets();
+
+        if (m_scheduler->IsBatchInFlight() == false && m_scheduler->GetTotalTicks() != m_lastSentTicks)
+        {
+            m_lastSentTicks = m_scheduler->GetTotalTicks();
+            SendState();
+            m_spectatorBroadcaster.Broadcast(*m_scheduler);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 MatchServer::GetNumClients() const
+    {
+        return u32(m_clients.size());
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u64 MatchServer::GetBytesSent() const
+    {
+        return m_bytesSent;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    const SpectatorBroadcaster& MatchServer::GetSpectatorBroadcaster() const
+    {
+        return m_spectatorBroadcaster;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServer::ReceivePackets()
+    {
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+        UdpSocket::Address address;
+
+        u32 size = m_socket.Receive(buffer, ServerProtocol::k_maxPacketSize, address);
+        while (size > 0)
+        {
+            ServerProtocol::PacketReader reader(buffer, size);
+            ServerProtocol::PacketType type;
+            if (reader.Read(type) == true)
+            {
+                switch (type)
+                {
+                    case ServerProtocol::PacketType::k_join:
+                    {
+                        u32 token;
+                        if (reader.Read(token) == true)
+                        {
+                            OnJoin(address, token);
+                        }
+                        break;
+                    }
+                    case ServerProtocol::PacketType::k_input:
+                    {
+                        u32 clientId;
+                        f32 targetY;
+                        if (reader.Read(clientId) == true && reader.Read(targetY) == true)
+                        {
+                            OnInput(address, clientId, targetY);
+                        }
+                        break;
+                    }
+                    case ServerProtocol::PacketType::k_spectate:
+                    {
+                        u32 token;
+                        u32 matchId;
+                        if (reader.Read(token) == true && reader.Read(matchId) == true)
+                        {
+                            OnSpectate(address, token, matchId);
+                        }
+                        break;
+                    }
+                    case ServerProtocol::PacketType::k_ack:
+                    {
+                        u32 spectatorId;
+                        u32 tick;
+                        if (reader.Read(spectatorId) == true && reader.Read(tick) == true)
+                        {
+                            m_spectatorBroadcaster.OnAck(address, spectatorId, tick);
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+
+            size = m_socket.Receive(buffer, ServerProtocol::k_maxPacketSize, address);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServer::OnJoin(const UdpSocket::Address& in_address, u32 in_token)
+    {
+        Client client;
+        client.m_address = in_address;
+        client.m_token = in_token;
+
+        if (m_waitingMatch != nullptr)
+        {
+            client.m_matchId = m_waitingMatchId;
+            client.m_playerIndex = 1;
+            m_waitingMatch->SetPaddleControl(1, MatchSimulation::PaddleControl::k_remote);
+            m_waitingMatch = nullptr;
+        }
+        else
+        {
+            MatchSimulationUPtr match(new MatchSimulation(m_matchConfig, m_nextSeed++));
+            match->SetPaddleControl(0, MatchSimulation::PaddleControl::k_remote);
+            m_waitingMatch = match.get();
+
+            client.m_playerIndex = 0;
+            client.m_matchId = m_scheduler->AddMatch(std::move(match));
+            m_waitingMatchId = client.m_matchId;
+        }
+
+        u32 clientId = u32(m_clients.size());
+        m_clients.push_back(client);
+
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+        ServerProtocol::PacketWriter writer(buffer);
+        writer.Write(ServerProtocol::PacketType::k_joined);
+        writer.Write(in_token);
+        writer.Write(clientId);
+        m_socket.Send(in_address, buffer, writer.GetSize());
+        m_bytesSent += writer.GetSize();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServer::OnInput(const UdpSocket::Address& in_address, u32 in_clientId, f32 in_targetY)
+    {
+        if (in_clientId >= m_clients.size())
+        {
+            return;
+        }
+
+        const Client& client = m_clients[in_clientId];
+        if (client.m_address.m_ip != in_address.m_ip || client.m_address.m_port != in_address.m_port)
+        {
+            return;
+        }
+
+        MatchSimulation* match = m_scheduler->GetMatch(client.m_matchId);
+        if (match != nullptr)
+        {
+            match->SetRemoteTarget(client.m_playerIndex, in_targetY);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServer::OnSpectate(const UdpSocket::Address& in_address, u32 in_token, u32 in_matchId)
+    {
+        if (in_matchId >= m_scheduler->GetNumMatches())
+        {
+            return;
+        }
+
+        u32 spectatorId = m_spectatorBroadcaster.AddSpectator(in_address, in_matchId);
+
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+        ServerProtocol::PacketWriter writer(buffer);
+        writer.Write(ServerProtocol::PacketType::k_spectating);
+        writer.Write(in_token);
+        writer.Write(spectatorId);
+        m_socket.Send(in_address, buffer, writer.GetSize());
+        m_bytesSent += writer.GetSize();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServer::SendState()
+    {
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+
+        for (const auto& client : m_clients)
+        {
+            const MatchSimulation* match = m_scheduler->GetMatch(client.m_matchId);
+            if (match == nullptr)
+            {
+                continue;
+            }
+
+            ServerProtocol::PacketWriter writer(buffer);
+            writer.Write(ServerProtocol::PacketType::k_state);
+            writer.Write(client.m_token);
+            writer.Write(match->GetTickCount());
+            WriteBody(writer, match->GetBall());
+            WriteBody(writer, match->GetPaddle(0));
+            WriteBody(writer, match->GetPaddle(1));
+            writer.Write(u8(match->GetScores()[0]));
+            writer.Write(u8(match->GetScores()[1]));
+
+            m_socket.Send(client.m_address, buffer, writer.GetSize());
+            m_bytesSent += writer.GetSize();
+        }
+    }
+}
@@ -0,0 +1,140 @@
+//
+//  MatchServer.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_MATCHSERVER_H_
+#define _APPSOURCE_SERVER_MATCHSERVER_H_
+
+#include <ForwardDeclarations.h>
+
+#include <Server/MatchSimulation.h>
+#include <Server/SpectatorBroadcaster.h>
+#include <Server/UdpSocket.h>
+
+#include <vector>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// Accepts clients over UDP and pairs them into matches on
+    /// the match scheduler. A client that joins takes a paddle
+    /// in a waiting match, or starts a new one against the AI
+    /// until a second client arrives. Clients send their paddle
+    /// target and receive the state of their match after every
+    /// completed scheduler batch. Spectators can also watch any
+    /// match and are streamed delta compressed snapshots.
+    //------------------------------------------------------------
+    class MatchServer final
+    {
+    public:
+        //------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @param The scheduler that matches are added to.
+        /// @param The dimensions used for new matches.
+        /// @param The port to listen on.
+        //------------------------------------------------------------
+        MatchServer(MatchScheduler* in_scheduler, const MatchConfig& in_matchConfig, u16 in_port);
+        //------------------------------------------------------------
+        /// Handles all pending packets and, if the scheduler is
+        /// between batches, sends the latest match state to every
+        /// client. Should be called once per frame from the main
+        /// thread before the scheduler is updated.
+        //------------------------------------------------------------
+        void Update();
+        //------------------------------------------------------------
+        /// @return The number of connected clients.
+        //------------------------------------------------------------
+        u32 GetNumClients() const;
+        //------------------------------------------------------------
+        /// @return The total number of bytes sent to clients.
+        //------------------------------------------------------------
+        u64 GetBytesSent() const;
+        //------------------------------------------------------------
+        /// @return The spectator stream.
+        //------------------------------------------------------------
+        const SpectatorBroadcaster& GetSpectatorBroadcaster() const;
+
+    private:
+        //------------------------------------------------------------
+        /// A connected client.
+        //------------------------------------------------------------
+        struct Client
+        {
+            UdpSocket::Address m_address;
+            u32 m_token = 0;
+            u32 m_matchId = 0;
+            u32 m_playerIndex = 0;
+        };
+        //------------------------------------------------------------
+        /// Reads and dispatches every pending packet.
+        //------------------------------------------------------------
+        void ReceivePackets();
+        //------------------------------------------------------------
+        /// Adds a client to a match and acknowledges the join.
+        ///
+        /// @param The address of the client.
+        /// @param The token the client identifies itself with.
+        //------------------------------------------------------------
+        void OnJoin(const UdpSocket::Address& in_address, u32 in_token);
+        //------------------------------------------------------------
+        /// Applies a client's paddle target to its match.
+        ///
+        /// @param The address the input came from.
+        /// @param The client id.
+        /// @param The paddle target.
+        //------------------------------------------------------------
+        void OnInput(const UdpSocket::Address& in_address, u32 in_clientId, f32 in_targetY);
+        //------------------------------------------------------------
+        /// Adds a spectator to a match and acknowledges it.
+        ///
+        /// @param The address of the spectator.
+        /// @param The token the spectator identifies itself with.
+        /// @param The match to watch.
+        //------------------------------------------------------------
+        void OnSpectate(const UdpSocket::Address& in_address, u32 in_token, u32 in_matchId);
+        //------------------------------------------------------------
+        /// Sends the state of each client's match to it.
+        //------------------------------------------------------------
+        void SendState();
+
+        MatchScheduler* m_scheduler;
+        MatchConfig m_matchConfig;
+        UdpSocket m_socket;
+        SpectatorBroadcaster m_spectatorBroadcaster;
+
+        std::vector<Client> m_clients;
+        MatchSimulation* m_waitingMatch = nullptr;
+        u32 m_waitingMatchId = 0;
+        u32 m_nextSeed = 1;
+
+        u64 m_lastSentTicks = 0;
+        u64 m_bytesSent = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,178 @@
+//
+//  MatchServerState.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/MatchServerState.h>
+
+#include <Server/MatchScheduler.h>
+#include <Server/MatchServer.h>
+#include <Server/MatchSimulation.h>
+#include <Server/ServerProtocol.h>
+#include <Server/SpectatorBroadcaster.h>
+#include <Server/SyntheticClientLoad.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Rendering/Model.h>
+
+#include <algorithm>
+
+namespace CSPong
+{
+    namespace
+    {
+        const u32 k_tickRate = 60;
+        const f32 k_rampInterval = 5.0f;
+        const f32 k_maxBackpressure = 0.01f;
+        const u32 k_minRampStep = 32;
+        const u32 k_remoteClientsPerRamp = 16;
+        const u32 k_spectatorsPerRamp = 16;
+        const u32 k_maxSpectators = 256;
+        const u32 k_numWatchedMatches = 4;
+        const f32 k_paddlePercentageOffsetFromCentre = 0.4f;
+    }
+
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    MatchServerState::MatchServerState()
+    {
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    MatchServerState::~MatchServerState()
+    {
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServerState::OnInit()
+    {
+        auto resourcePool = CS::Application::Get()->GetResourcePool();
+        CS::ModelCSPtr arenaMesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Arena.csmodel");
+        CS::ModelCSPtr ballMesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Ball.csmodel");
+        CS::ModelCSPtr paddleMesh = resourcePool->LoadResource<CS::Model>(CS::StorageLocation::k_package, "Models/Paddle/PaddleLeft.csmodel");
+
+        m_matchConfig.m_arenaSize = arenaMesh->GetAABB().GetSize().XY() * 0.9f;
+        m_matchConfig.m_ballSize = ballMesh->GetAABB().GetSize().XY();
+        m_matchConfig.m_paddleSize = paddleMesh->GetAABB().GetSize().XY();
+        m_matchConfig.m_paddleOffsetX = arenaMesh->GetAABB().GetSize().x * k_paddlePercentageOffsetFromCentre;
+
+        m_scheduler = MatchSchedulerUPtr(new MatchScheduler(k_tickRate));
+        m_server = MatchServerUPtr(new MatchServer(m_scheduler.get(), m_matchConfig, ServerProtocol::k_serverPort));
+
+        UdpSocket::Address serverAddress;
+        serverAddress.m_ip = UdpSocket::k_loopbackAddress;
+        serverAddress.m_port = ServerProtocol::k_serverPort;
+        m_clientLoad = SyntheticClientLoadUPtr(new SyntheticClientLoad(serverAddress, m_matchConfig.m_arenaSize.y));
+
+        resourcePool->ReleaseAllUnused();
+
+        CS_LOG_VERBOSE("Dedicated server listening on port " + CS::ToString(u32(ServerProtocol::k_serverPort)) + " with " + CS::ToString(m_scheduler->GetNumWorkers()) + " workers.");
+
+        RampLoad();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServerState::OnUpdate(f32 in_timeSinceLastUpdate)
+    {
+        m_clientLoad->Update(in_timeSinceLastUpdate);
+        m_server->Update();
+        m_scheduler->Update();
+
+        m_rampTimer += in_timeSinceLastUpdate;
+        if (m_rampTimer >= k_rampInterval)
+        {
+            m_rampTimer = 0.0f;
+            RampLoad();
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServerState::OnDestroy()
+    {
+        m_clientLoad.reset();
+        m_server.reset();
+        m_scheduler.reset();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServerState::RampLoad()
+    {
+        u32 numMatches = m_scheduler->GetNumMatches();
+        f32 backpressure = m_scheduler->GetBackpressure();
+
+        CS_LOG_VERBOSE("Matches: " + CS::ToString(numMatches) + ", clients: " + CS::ToString(m_clientLoad->GetNumJoinedClients()) + ", backpressure: " + CS::ToString(backpressure));
+        LogSpectatorStats();
+
+        if (m_isSaturated == true)
+        {
+            return;
+        }
+
+        if (numMatches > 0 && backpressure > k_maxBackpressure)
+        {
+            m_isSaturated = true;
+
+            u32 numWorkers = m_scheduler->GetNumWorkers();
+            CS_LOG_VERBOSE("Sustained " + CS::ToString(m_sustainedMatches) + " matches at " + CS::ToString(k_tickRate) + " Hz on " + CS::ToString(numWorkers) + " cores: " + CS::ToString(f32(m_sustainedMatches) / f32(numWorkers)) + " matches per core.");
+            return;
+        }
+
+        m_sustainedMatches = numMatches;
+
+        m_clientLoad->AddClients(k_remoteClientsPerRamp);
+
+        //A few popular matches with many viewers each, so deltas are shared between spectators.
+        if (numMatches > 0 && m_server->GetSpectatorBroadcaster().GetNumSpectators() < k_maxSpectators)
+        {
+            m_clientLoad->AddSpectators(k_spectatorsPerRamp, std::min(numMatches, k_numWatchedMatches));
+        }
+
+        //Each pair of remote clients creates a match of its own.
+        u32 rampStep = std::max(k_minRampStep, numMatches / 4);
+        u32 numAIMatches = rampStep - std::min(rampStep, k_remoteClientsPerRamp / 2);
+        for (u32 i = 0; i < numAIMatches; ++i)
+        {
+            m_scheduler->AddMatch(MatchSimulationUPtr(new MatchSimulation(m_matchConfig, m_nextSeed++)));
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchServerState::LogSpectatorStats() const
+    {
+        const SpectatorBroadcaster::Stats& stats = m_server->GetSpectatorBroadcaster().GetStats();
+        if (stats.m_snapshotsSent == 0)
+        {
+            return;
+        }
+
+        f64 deltaBytesPerSnapshot = f64(stats.m_deltaBytesSent) / f64(stats.m_snapshotsSent);
+        f64 naiveBytesPerSnapshot = f64(stats.m_naiveBytes) / f64(stats.m_snapshotsSent);
+        f64 encodeMicroseconds = (stats.m_encodeSeconds * 1000000.0) / f64(stats.m_encodes);
+
+        CS_LOG_VERBOSE("Spectators: " + CS::ToString(m_server->GetSpectatorBroadcaster().GetNumSpectators()) + ", bytes per snapshot: " + CS::ToString(f32(deltaBytesPerSnapshot)) + " (naive " + CS::ToString(f32(naiveBytesPerSnapshot)) + "), encodes: " + CS::ToString(u32(stats.m_encodes)) + " for " + CS::ToString(u32(stats.m_snapshotsSent)) + " sends, encode cost: " + CS::ToString(f32(encodeMicroseconds)) + " us, decode failures: " + CS::ToString(m_clientLoad->GetSnapshotDecodeFailures()));
+    }
+}
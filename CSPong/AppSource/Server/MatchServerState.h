@@ -0,0 +1,107 @@
+//
+//  MatchServerState.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_MATCHSERVERSTATE_H_
+#define _APPSOURCE_SERVER_MATCHSERVERSTATE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <Server/MatchSimulation.h>
+
+#include <ChilliSource/Core/State.h>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// The initial state of the dedicated server build (see
+    /// CSPONG_DEDICATED_SERVER in CSPong.cpp). It renders
+    /// nothing; instead it hosts headless matches on the match
+    /// scheduler, serves remote clients over UDP and drives a
+    /// local synthetic client load against itself.
+    ///
+    /// To measure capacity the number of matches is ramped up
+    /// while the scheduler backpressure stays below a threshold.
+    /// When the threshold is first crossed the last sustained
+    /// match count is reported per core. Matches are ticked at
+    /// 60 Hz so the server must be configured to update at 60
+    /// frames per second or faster, otherwise every tick is
+    /// counted as late.
+    //------------------------------------------------------------
+    class MatchServerState final : public CS::State
+    {
+    public:
+        //------------------------------------------------------------
+        /// Constructor
+        //------------------------------------------------------------
+        MatchServerState();
+        //------------------------------------------------------------
+        /// Destructor
+        //------------------------------------------------------------
+        ~MatchServerState();
+        //------------------------------------------------------------
+        /// Reads the match dimensions from the game models and
+        /// starts the server.
+        //------------------------------------------------------------
+        void OnInit() override;
+        //------------------------------------------------------------
+        /// Services clients, ticks the scheduler and ramps the
+        /// load.
+        ///
+        /// @param Time since last update in seconds
+        //------------------------------------------------------------
+        void OnUpdate(f32 in_timeSinceLastUpdate) override;
+        //------------------------------------------------------------
+        /// Shuts the server down.
+        //------------------------------------------------------------
+        void OnDestroy() override;
+
+    private:
+        //------------------------------------------------------------
+        /// Adds the next step of AI and remote matches, or reports
+        /// the sustained capacity if the scheduler is saturated.
+        //------------------------------------------------------------
+        void RampLoad();
+        //------------------------------------------------------------
+        /// Logs the spectator bandwidth and encode cost against
+        /// naive full snapshots.
+        //------------------------------------------------------------
+        void LogSpectatorStats() const;
+
+        MatchConfig m_matchConfig;
+        MatchSchedulerUPtr m_scheduler;
+        MatchServerUPtr m_server;
+        SyntheticClientLoadUPtr m_clientLoad;
+
+        f32 m_rampTimer = 0.0f;
+        u32 m_sustainedMatches = 0;
+        u32 m_nextSeed = 1u << 31;
+        bool m_isSaturated = false;
+    };
+}
+
+#endif
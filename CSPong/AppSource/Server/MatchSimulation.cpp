@@ -0,0 +1,365 @@
+//
+//  MatchSimulation.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/MatchSimulation.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <cmath>
+
+namespace CSPong
+{
+    namespace
+    {
+        const f32 k_border = 1.0f;
+        const f32 k_ballInitialImpulse = 3000.0f;
+        const f32 k_ballCollisionImpulse = 300.0f;
+        const f32 k_paddleMaxForce = 500000.0f;
+        const f32 k_paddleMass = 100.0f;
+        const f32 k_paddleDragFactor = 0.2f;
+        const f32 k_paddleCoefficientOfRestitution = 0.6f;
+        const f32 k_serveDelay = 3.8f;
+        const u32 k_targetScore = 5;
+
+        //---------------------------------------------------------
+        /// Tests for overlap between two boxes in the same way as
+        /// PhysicsSystem. If they overlap the direction and
+        /// distance required to push box A out of box B is
+        /// returned.
+        ///
+        /// @param The centre of box A.
+        /// @param The size of box A.
+        /// @param The centre of box B.
+        /// @param The size of box B.
+        /// @param [Out] The collision direction.
+        /// @param [Out] The intersection resolution.
+        ///
+        /// @return Whether or not the boxes overlap.
+        //---------------------------------------------------------
+        bool TestCollision(const CS::Vector2& in_positionA, const CS::Vector2& in_sizeA, const CS::Vector2& in_positionB, const CS::Vector2& in_sizeB, CS::Vector2& out_direction, CS::Vector2& out_resolution)
+        {
+            const CS::Rectangle rectA(in_positionA, in_sizeA);
+            const CS::Rectangle rectB(in_positionB, in_sizeB);
+
+            if (rectA.Left() < rectB.Right() && rectA.Right() > rectB.Left() && rectA.Bottom() < rectB.Top() && rectA.Top() > rectB.Bottom())
+            {
+                f32 minIntersection = rectB.Right() - rectA.Left();
+                out_direction = CS::Vector2(1.0f, 0.0f);
+
+                f32 intersection = rectA.Right() - rectB.Left();
+                if (intersection < minIntersection)
+                {
+                    minIntersection = intersection;
+                    out_direction = CS::Vector2(-1.0f, 0.0f);
+                }
+
+                intersection = rectB.Top() - rectA.Bottom();
+                if (intersection < minIntersection)
+                {
+                    minIntersection = intersection;
+                    out_direction = CS::Vector2(0.0f, 1.0f);
+                }
+
+                intersection = rectA.Top() - rectB.Bottom();
+                if (intersection < minIntersection)
+                {
+                    minIntersection = intersection;
+                    out_direction = CS::Vector2(0.0f, -1.0f);
+                }
+
+                out_resolution = out_direction * minIntersection;
+                return true;
+            }
+
+            return false;
+        }
+        //---------------------------------------------------------
+        /// Pushes a body out of a static wall and reflects its
+        /// velocity, as DynamicBodyComponent::OnStaticCollision()
+        /// does.
+        ///
+        /// @param The body.
+        /// @param The collision direction.
+        /// @param The intersection resolution.
+        //---------------------------------------------------------
+        void ApplyStaticCollision(MatchSimulation::Body& in_body, const CS::Vector2& in_direction, const CS::Vector2& in_resolution)
+        {
+            in_body.m_position += in_resolution;
+            in_body.m_velocity -= (1.0f + in_body.m_coefficientOfRestitution) * in_direction * CS::Vector2::DotProduct(in_body.m_velocity, in_direction);
+        }
+        //---------------------------------------------------------
+        /// Pushes a body out of another dynamic body and exchanges
+        /// momentum, as DynamicBodyComponent::OnDynamicCollision()
+        /// does.
+        ///
+        /// @param The body.
+        /// @param The body it collided with.
+        /// @param The collision direction.
+        /// @param The intersection resolution.
+        //---------------------------------------------------------
+        void ApplyDynamicCollision(MatchSimulation::Body& in_body, const MatchSimulation::Body& in_collidedWith, const CS::Vector2& in_direction, const CS::Vector2& in_resolution)
+        {
+            f32 collisionShare = in_collidedWith.m_mass / (in_body.m_mass + in_collidedWith.m_mass);
+            in_body.m_position += in_resolution * collisionShare;
+            in_body.m_velocity -= collisionShare * ((1.0f + in_body.m_coefficientOfRestitution) * in_direction * CS::Vector2::DotProduct(in_body.m_velocity, in_direction));
+        }
+    }
+
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    MatchSimulation::MatchSimulation(const MatchConfig& in_config, u32 in_seed)
+    : m_config(in_config), m_random(in_seed)
+    {
+        m_ball.m_size = m_config.m_ballSize;
+
+        for (u32 i = 0; i < ScoringSystem::k_numPlayers; ++i)
+        {
+            Body& paddle = m_paddles[i];
+            paddle.m_size = m_config.m_paddleSize;
+            paddle.m_mass = k_paddleMass;
+            paddle.m_dragFactor = k_paddleDragFactor;
+            paddle.m_coefficientOfRestitution = k_paddleCoefficientOfRestitution;
+            paddle.m_position.x = (i == 0) ? -m_config.m_paddleOffsetX : m_config.m_paddleOffsetX;
+
+            m_paddleControls[i] = PaddleControl::k_ai;
+            m_remoteTargets[i] = 0.0f;
+            m_scores[i] = 0;
+        }
+
+        m_serveTimer = k_serveDelay;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchSimulation::SetPaddleControl(u32 in_playerIndex, PaddleControl in_control)
+    {
+        CS_ASSERT(in_playerIndex < ScoringSystem::k_numPlayers, "Index out of range");
+
+        m_paddleControls[in_playerIndex].store(in_control, std::memory_order_relaxed);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchSimulation::SetRemoteTarget(u32 in_playerIndex, f32 in_targetY)
+    {
+        CS_ASSERT(in_playerIndex < ScoringSystem::k_numPlayers, "Index out of range");
+
+        m_remoteTargets[in_playerIndex].store(in_targetY, std::memory_order_relaxed);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchSimulation::Tick(f32 in_deltaTime)
+    {
+        ++m_tickCount;
+
+        if (m_ballActive == false)
+        {
+            m_serveTimer -= in_deltaTime;
+            if (m_serveTimer <= 0.0f)
+            {
+                Serve();
+            }
+        }
+
+        UpdatePaddles(in_deltaTime);
+
+        Integrate(m_ball, in_deltaTime);
+        for (auto& paddle : m_paddles)
+        {
+            Integrate(paddle, in_deltaTime);
+        }
+
+        ResolveCollisions();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    const MatchSimulation::Body& MatchSimulation::GetBall() const
+    {
+        return m_ball;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    const MatchSimulation::Body& MatchSimulation::GetPaddle(u32 in_playerIndex) const
+    {
+        CS_ASSERT(in_playerIndex < ScoringSystem::k_numPlayers, "Index out of range");
+
+        return m_paddles[in_playerIndex];
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    const ScoringSystem::Scores& MatchSimulation::GetScores() const
+    {
+        return m_scores;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 MatchSimulation::GetTickCount() const
+    {
+        return m_tickCount;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchSimulation::UpdatePaddles(f32 in_deltaTime)
+    {
+        for (u32 i = 0; i < ScoringSystem::k_numPlayers; ++i)
+        {
+            Body& paddle = m_paddles[i];
+            f32 targetY = 0.0f;
+
+            if (m_paddleControls[i].load(std::memory_order_relaxed) == PaddleControl::k_remote)
+            {
+                targetY = m_remoteTargets[i].load(std::memory_order_relaxed);
+            }
+            else
+            {
+                //If ball is not coming towards us then just return to the centre
+                CS::Vector2 ourDirection = CS::Vector2::Normalise(-paddle.m_position);
+                bool isBallMovingTowardsUs = m_ball.m_velocity.LengthSquared() > 0.0f && CS::Vector2::DotProduct(ourDirection, CS::Vector2::Normalise(m_ball.m_velocity)) < 0.0f;
+                if (isBallMovingTowardsUs == true)
+                {
+                    targetY = m_ball.m_position.y;
+                }
+            }
+
+            paddle.m_impulse += CS::Vector2(0.0f, targetY - paddle.m_position.y) * k_paddleMaxForce * in_deltaTime;
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchSimulation::Integrate(Body& in_body, f32 in_deltaTime) const
+    {
+        CS::Vector2 acceleration = in_body.m_impulse / in_body.m_mass;
+        in_body.m_impulse = CS::Vector2::k_zero;
+        in_body.m_velocity += acceleration * in_deltaTime;
+        in_body.m_velocity *= (1.0f - in_body.m_dragFactor);
+        in_body.m_position += in_body.m_velocity * in_deltaTime;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchSimulation::ResolveCollisions()
+    {
+        CS::Vector2 direction;
+        CS::Vector2 resolution;
+
+        for (auto& paddle : m_paddles)
+        {
+            if (TestCollision(m_ball.m_position, m_ball.m_size, paddle.m_position, paddle.m_size, direction, resolution) == true)
+            {
+                Body ballBeforeCollision = m_ball;
+                ApplyDynamicCollision(m_ball, paddle, direction, resolution);
+                ApplyDynamicCollision(paddle, ballBeforeCollision, -direction, -resolution);
+
+                m_ballDirection -= 2.0f * direction * CS::Vector2::DotProduct(m_ballDirection, direction);
+                m_ball.m_impulse += m_ballDirection * k_ballCollisionImpulse;
+            }
+        }
+
+        const CS::Vector2 wallSize(m_config.m_arenaSize.x + k_border * 2.0f, k_border);
+        const f32 wallY = m_config.m_arenaSize.y * 0.5f + k_border * 0.5f;
+        const std::array<CS::Vector2, 2> wallPositions = {{ CS::Vector2(0.0f, -wallY), CS::Vector2(0.0f, wallY) }};
+
+        for (const auto& wallPosition : wallPositions)
+        {
+            if (TestCollision(m_ball.m_position, m_ball.m_size, wallPosition, wallSize, direction, resolution) == true)
+            {
+                ApplyStaticCollision(m_ball, direction, resolution);
+
+                m_ballDirection -= 2.0f * direction * CS::Vector2::DotProduct(m_ballDirection, direction);
+                m_ball.m_impulse += m_ballDirection * k_ballCollisionImpulse;
+            }
+
+            for (auto& paddle : m_paddles)
+            {
+                if (TestCollision(paddle.m_position, paddle.m_size, wallPosition, wallSize, direction, resolution) == true)
+                {
+                    ApplyStaticCollision(paddle, direction, resolution);
+                }
+            }
+        }
+
+        const CS::Vector2 goalSize(k_border, m_config.m_arenaSize.y);
+        const f32 goalX = m_config.m_arenaSize.x * 0.5f + k_border * 0.5f;
+
+        if (TestCollision(m_ball.m_position, m_ball.m_size, CS::Vector2(-goalX, 0.0f), goalSize, direction, resolution) == true)
+        {
+            OnGoalScored(1);
+        }
+        else if (TestCollision(m_ball.m_position, m_ball.m_size, CS::Vector2(goalX, 0.0f), goalSize, direction, resolution) == true)
+        {
+            OnGoalScored(0);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchSimulation::OnGoalScored(u32 in_playerIndex)
+    {
+        m_scores[in_playerIndex]++;
+
+        //A finished match rolls straight into the next one so the server load stays constant.
+        if (m_scores[in_playerIndex] >= k_targetScore)
+        {
+            m_scores.fill(0);
+        }
+
+        m_ball.m_position = CS::Vector2::k_zero;
+        m_ball.m_velocity = CS::Vector2::k_zero;
+        m_ballActive = false;
+        m_serveTimer = k_serveDelay;
+
+        for (u32 i = 0; i < ScoringSystem::k_numPlayers; ++i)
+        {
+            if (m_paddleControls[i].load(std::memory_order_relaxed) == PaddleControl::k_ai)
+            {
+                m_paddles[i].m_position.y = 0.0f;
+            }
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void MatchSimulation::Serve()
+    {
+        m_ballActive = true;
+
+        //Pick a random direction to start the ball
+        std::uniform_real_distribution<f32> angleDistribution(CS::MathUtils::k_pi * 0.25f, CS::MathUtils::k_pi * 0.75f);
+        std::bernoulli_distribution flipDistribution(0.5);
+
+        m_ballDirection.x = std::sin(angleDistribution(m_random));
+        m_ballDirection.y = std::cos(angleDistribution(m_random));
+
+        if (flipDistribution(m_random) == true)
+        {
+            m_ballDirection.x = -m_ballDirection.x;
+        }
+
+        if (flipDistribution(m_random) == true)
+        {
+            m_ballDirection.y = -m_ballDirection.y;
+        }
+
+        m_ball.m_impulse += m_ballDirection * k_ballInitialImpulse;
+    }
+}
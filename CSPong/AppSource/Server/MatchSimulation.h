@@ -0,0 +1,193 @@
+//
+//  MatchSimulation.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_MATCHSIMULATION_H_
+#define _APPSOURCE_SERVER_MATCHSIMULATION_H_
+
+#include <ForwardDeclarations.h>
+
+#include <Game/ScoringSystem.h>
+
+#include <ChilliSource/Core/Math.h>
+
+#include <array>
+#include <atomic>
+#include <random>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// The dimensions shared by every headless match. These are
+    /// read from the same models that GameEntityFactory uses so
+    /// a headless match plays out on the same arena as the
+    /// client game.
+    //------------------------------------------------------------
+    struct MatchConfig
+    {
+        CS::Vector2 m_arenaSize;
+        CS::Vector2 m_ballSize;
+        CS::Vector2 m_paddleSize;
+        f32 m_paddleOffsetX = 0.0f;
+    };
+    //------------------------------------------------------------
+    /// A single game of pong run without entities, rendering or
+    /// input. This reproduces the rules of GameState: the
+    /// physics of PhysicsSystem and DynamicBodyComponent, the
+    /// goal triggers of ScoringSystem and the paddle forces of
+    /// AIControllerComponent and TouchControllerComponent. Each
+    /// paddle can either be driven by the AI or by a remote
+    /// target position received from a client.
+    ///
+    /// A match only touches its own state during a tick so
+    /// different matches can be ticked on different threads.
+    //------------------------------------------------------------
+    class MatchSimulation final
+    {
+    public:
+        //------------------------------------------------------------
+        /// Identifies what drives a paddle.
+        //------------------------------------------------------------
+        enum class PaddleControl
+        {
+            k_ai,
+            k_remote
+        };
+        //------------------------------------------------------------
+        /// The physics state of a single body. This mirrors the
+        /// members of DynamicBodyComponent with the position held
+        /// in the body rather than an entity transform.
+        //------------------------------------------------------------
+        struct Body
+        {
+            CS::Vector2 m_position;
+            CS::Vector2 m_size;
+            CS::Vector2 m_velocity;
+            CS::Vector2 m_impulse;
+            f32 m_mass = 1.0f;
+            f32 m_dragFactor = 0.0f;
+            f32 m_coefficientOfRestitution = 1.0f;
+        };
+        //------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @param The shared match dimensions.
+        /// @param The seed used for the ball serve directions.
+        //------------------------------------------------------------
+        MatchSimulation(const MatchConfig& in_config, u32 in_seed);
+        //------------------------------------------------------------
+        /// Sets what drives a paddle. This is safe to call from a
+        /// different thread to the one ticking the match.
+        ///
+        /// @param The player index.
+        /// @param What should drive the player's paddle.
+        //------------------------------------------------------------
+        void SetPaddleControl(u32 in_playerIndex, PaddleControl in_control);
+        //------------------------------------------------------------
+        /// Sets the target height of a remotely controlled paddle.
+        /// This is safe to call from a different thread to the one
+        /// ticking the match.
+        ///
+        /// @param The player index.
+        /// @param The target height in arena space.
+        //------------------------------------------------------------
+        void SetRemoteTarget(u32 in_playerIndex, f32 in_targetY);
+        //------------------------------------------------------------
+        /// Advances the match by a single fixed step.
+        ///
+        /// @param The fixed time step in seconds.
+        //------------------------------------------------------------
+        void Tick(f32 in_deltaTime);
+        //------------------------------------------------------------
+        /// @return The ball body.
+        //------------------------------------------------------------
+        const Body& GetBall() const;
+        //------------------------------------------------------------
+        /// @param The player index.
+        ///
+        /// @return The paddle body for the given player.
+        //------------------------------------------------------------
+        const Body& GetPaddle(u32 in_playerIndex) const;
+        //------------------------------------------------------------
+        /// @return The current scores.
+        //------------------------------------------------------------
+        const ScoringSystem::Scores& GetScores() const;
+        //------------------------------------------------------------
+        /// @return The number of ticks the match has run.
+        //------------------------------------------------------------
+        u32 GetTickCount() const;
+
+    private:
+        //------------------------------------------------------------
+        /// Applies the paddle forces from either the AI or the
+        /// remote target.
+        ///
+        /// @param The fixed time step in seconds.
+        //------------------------------------------------------------
+        void UpdatePaddles(f32 in_deltaTime);
+        //------------------------------------------------------------
+        /// Integrates a body in the same way as
+        /// DynamicBodyComponent::OnPhysicsUpdate().
+        ///
+        /// @param The body.
+        /// @param The fixed time step in seconds.
+        //------------------------------------------------------------
+        void Integrate(Body& in_body, f32 in_deltaTime) const;
+        //------------------------------------------------------------
+        /// Resolves the ball against the paddles and all bodies
+        /// against the arena walls, then checks the goals.
+        //------------------------------------------------------------
+        void ResolveCollisions();
+        //------------------------------------------------------------
+        /// Awards a goal, resetting the ball and the AI paddles
+        /// and starting the serve delay.
+        ///
+        /// @param The player index that scored.
+        //------------------------------------------------------------
+        void OnGoalScored(u32 in_playerIndex);
+        //------------------------------------------------------------
+        /// Launches the ball in a random direction.
+        //------------------------------------------------------------
+        void Serve();
+
+        MatchConfig m_config;
+        std::minstd_rand m_random;
+
+        Body m_ball;
+        std::array<Body, ScoringSystem::k_numPlayers> m_paddles;
+        std::array<std::atomic<PaddleControl>, ScoringSystem::k_numPlayers> m_paddleControls;
+        std::array<std::atomic<f32>, ScoringSystem::k_numPlayers> m_remoteTargets;
+        CS::Vector2 m_ballDirection;
+
+        ScoringSystem::Scores m_scores;
+        f32 m_serveTimer = 0.0f;
+        bool m_ballActive = false;
+        u32 m_tickCount = 0;
+    };
+}
+
+#endif
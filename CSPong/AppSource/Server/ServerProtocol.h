@@ -0,0 +1,151 @@
+//
+//  ServerProtocol.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_SERVERPROTOCOL_H_
+#define _APPSOURCE_SERVER_SERVERPROTOCOL_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <cstring>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// The datagrams exchanged between the dedicated server and
+    /// its clients. Every packet starts with a single PacketType
+    /// byte. Multi-byte values are written in host byte order,
+    /// which is little endian on every supported platform.
+    ///
+    /// join:   [type][u32 client token]
+    /// joined: [type][u32 client token][u32 client id]
+    /// input:  [type][u32 client id][f32 paddle target y]
+    /// state:  [type][u32 client token][u32 tick][ball, paddle 0,
+    ///          paddle 1 as f32 position xy and velocity xy]
+    ///         [u8 score 0][u8 score 1]
+    ///
+    /// spectate:   [type][u32 client token][u32 match id]
+    /// spectating: [type][u32 client token][u32 spectator id]
+    /// ack:        [type][u32 spectator id][u32 snapshot tick]
+    /// snapshot:   [type][u32 match id][u32 tick][u32 baseline
+    ///              tick][bit packed delta, see SnapshotEncoder]
+    //------------------------------------------------------------
+    namespace ServerProtocol
+    {
+        const u16 k_serverPort = 27015;
+        const u32 k_maxPacketSize = 512;
+        const u32 k_fullStatePacketSize = 1 + 4 + 4 + 12 * 4 + 2;
+
+        enum class PacketType : u8
+        {
+            k_join,
+            k_joined,
+            k_input,
+            k_state,
+            k_spectate,
+            k_spectating,
+            k_ack,
+            k_snapshot
+        };
+        //------------------------------------------------------------
+        /// Writes values sequentially into a packet buffer.
+        //------------------------------------------------------------
+        class PacketWriter final
+        {
+        public:
+            //------------------------------------------------------------
+            /// @param The buffer to write to. Must be at least
+            /// k_maxPacketSize bytes.
+            //------------------------------------------------------------
+            PacketWriter(u8* in_buffer)
+            : m_buffer(in_buffer)
+            {
+            }
+            //------------------------------------------------------------
+            /// @param The value to append.
+            //------------------------------------------------------------
+            template <typename TValue> void Write(TValue in_value)
+            {
+                CS_ASSERT(m_size + sizeof(TValue) <= k_maxPacketSize, "Packet overflow.");
+                std::memcpy(m_buffer + m_size, &in_value, sizeof(TValue));
+                m_size += sizeof(TValue);
+            }
+            //------------------------------------------------------------
+            /// @return The number of bytes written.
+            //------------------------------------------------------------
+            u32 GetSize() const
+            {
+                return m_size;
+            }
+
+        private:
+            u8* m_buffer;
+            u32 m_size = 0;
+        };
+        //------------------------------------------------------------
+        /// Reads values sequentially from a received packet,
+        /// failing safely on truncated data.
+        //------------------------------------------------------------
+        class PacketReader final
+        {
+        public:
+            //------------------------------------------------------------
+            /// @param The received data.
+            /// @param The size of the received data.
+            //------------------------------------------------------------
+            PacketReader(const u8* in_buffer, u32 in_size)
+            : m_buffer(in_buffer), m_size(in_size)
+            {
+            }
+            //------------------------------------------------------------
+            /// @param [Out] The value read.
+            ///
+            /// @return Whether there was enough data left to read it.
+            //------------------------------------------------------------
+            template <typename TValue> bool Read(TValue& out_value)
+            {
+                if (m_position + sizeof(TValue) > m_size)
+                {
+                    return false;
+                }
+
+                std::memcpy(&out_value, m_buffer + m_position, sizeof(TValue));
+                m_position += sizeof(TValue);
+                return true;
+            }
+
+        private:
+            const u8* m_buffer;
+            u32 m_size;
+            u32 m_position = 0;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,161 @@
+//
+//  SnapshotEncoder.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/SnapshotEncoder.h>
+
+#include <Server/BitStream.h>
+#include <Server/MatchSimulation.h>
+
+#include <cmath>
+
+namespace CSPong
+{
+    namespace SnapshotEncoder
+    {
+        namespace
+        {
+            const f32 k_unitsPerQuantum = 1.0f / 128.0f;
+            const u32 k_sizeClassBits = 2;
+            const std::array<u32, 4> k_sizeClassPayloadBits = {{ 4, 8, 12, 32 }};
+
+            //------------------------------------------------------------
+            /// @param The value in world units.
+            ///
+            /// @return The value in fixed point.
+            //------------------------------------------------------------
+            s32 Quantise(f32 in_value)
+            {
+                return s32(std::floor(in_value / k_unitsPerQuantum + 0.5f));
+            }
+            //------------------------------------------------------------
+            /// Appends the quantised position and velocity of a body.
+            ///
+            /// @param The body.
+            /// @param [Out] The snapshot.
+            /// @param [In/Out] The next field index.
+            //------------------------------------------------------------
+            void QuantiseBody(const MatchSimulation::Body& in_body, Snapshot& out_snapshot, u32& inout_field)
+            {
+                out_snapshot.m_fields[inout_field++] = Quantise(in_body.m_position.x);
+                out_snapshot.m_fields[inout_field++] = Quantise(in_body.m_position.y);
+                out_snapshot.m_fields[inout_field++] = Quantise(in_body.m_velocity.x);
+                out_snapshot.m_fields[inout_field++] = Quantise(in_body.m_velocity.y);
+            }
+            //------------------------------------------------------------
+            /// Maps signed values to unsigned so that small magnitudes
+            /// of either sign need few bits.
+            ///
+            /// @param The signed value.
+            ///
+            /// @return The zigzag encoded value.
+            //------------------------------------------------------------
+            u32 ZigzagEncode(s32 in_value)
+            {
+                return (u32(in_value) << 1) ^ u32(in_value >> 31);
+            }
+            //------------------------------------------------------------
+            /// @param The zigzag encoded value.
+            ///
+            /// @return The signed value.
+            //------------------------------------------------------------
+            s32 ZigzagDecode(u32 in_value)
+            {
+                return s32(in_value >> 1) ^ -s32(in_value & 1);
+            }
+        }
+
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        Snapshot Quantise(const MatchSimulation& in_match)
+        {
+            Snapshot snapshot;
+            snapshot.m_tick = in_match.GetTickCount();
+
+            u32 field = 0;
+            QuantiseBody(in_match.GetBall(), snapshot, field);
+            QuantiseBody(in_match.GetPaddle(0), snapshot, field);
+            QuantiseBody(in_match.GetPaddle(1), snapshot, field);
+            snapshot.m_fields[field++] = s32(in_match.GetScores()[0]);
+            snapshot.m_fields[field++] = s32(in_match.GetScores()[1]);
+
+            return snapshot;
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        f32 Dequantise(s32 in_value)
+        {
+            return f32(in_value) * k_unitsPerQuantum;
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        void Encode(const Snapshot& in_snapshot, const Snapshot& in_baseline, BitWriter& out_writer)
+        {
+            for (u32 i = 0; i < Snapshot::k_numFields; ++i)
+            {
+                u32 delta = ZigzagEncode(in_snapshot.m_fields[i] - in_baseline.m_fields[i]);
+                if (delta == 0)
+                {
+                    out_writer.Write(0, 1);
+                    continue;
+                }
+
+                u32 sizeClass = 0;
+                while (sizeClass < k_sizeClassPayloadBits.size() - 1 && (delta >> k_sizeClassPayloadBits[sizeClass]) != 0)
+                {
+                    ++sizeClass;
+                }
+
+                out_writer.Write(1, 1);
+                out_writer.Write(sizeClass, k_sizeClassBits);
+                out_writer.Write(delta, k_sizeClassPayloadBits[sizeClass]);
+            }
+
+            out_writer.Flush();
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        bool Decode(BitReader& in_reader, const Snapshot& in_baseline, u32 in_tick, Snapshot& out_snapshot)
+        {
+            out_snapshot.m_tick = in_tick;
+
+            for (u32 i = 0; i < Snapshot::k_numFields; ++i)
+            {
+                s32 delta = 0;
+                if (in_reader.Read(1) == 1)
+                {
+                    u32 sizeClass = in_reader.Read(k_sizeClassBits);
+                    delta = ZigzagDecode(in_reader.Read(k_sizeClassPayloadBits[sizeClass]));
+                }
+
+                out_snapshot.m_fields[i] = in_baseline.m_fields[i] + delta;
+            }
+
+            return in_reader.HasOverflowed() == false;
+        }
+    }
+}
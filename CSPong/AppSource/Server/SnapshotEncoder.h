@@ -0,0 +1,110 @@
+//
+//  SnapshotEncoder.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_SNAPSHOTENCODER_H_
+#define _APPSOURCE_SERVER_SNAPSHOTENCODER_H_
+
+#include <ForwardDeclarations.h>
+
+#include <array>
+
+namespace CSPong
+{
+    class BitReader;
+    class BitWriter;
+
+    //------------------------------------------------------------
+    /// The quantised state of a match at a given tick. Positions
+    /// and velocities are stored in fixed point and the scores
+    /// are stored as plain integers, giving a flat array that
+    /// can be delta compressed field by field.
+    ///
+    /// Field order: ball, paddle 0 then paddle 1, each as
+    /// position x, position y, velocity x, velocity y; followed
+    /// by the two scores.
+    //------------------------------------------------------------
+    struct Snapshot
+    {
+        static const u32 k_numBodyFields = 12;
+        static const u32 k_numFields = k_numBodyFields + 2;
+
+        u32 m_tick = 0;
+        std::array<s32, k_numFields> m_fields;
+
+        Snapshot()
+        {
+            m_fields.fill(0);
+        }
+    };
+    //------------------------------------------------------------
+    /// Quantises match state and delta encodes it against an
+    /// acknowledged baseline.
+    ///
+    /// Each field is written as a single bit when it is
+    /// unchanged from the baseline. Otherwise the zigzag encoded
+    /// difference is written with a 2 bit size class selecting a
+    /// 4, 8, 12 or 32 bit payload. A full snapshot is simply a
+    /// delta against the zero baseline (tick 0).
+    //------------------------------------------------------------
+    namespace SnapshotEncoder
+    {
+        //------------------------------------------------------------
+        /// @param The match.
+        ///
+        /// @return The quantised state of the match.
+        //------------------------------------------------------------
+        Snapshot Quantise(const MatchSimulation& in_match);
+        //------------------------------------------------------------
+        /// @param A quantised value.
+        ///
+        /// @return The value in world units.
+        //------------------------------------------------------------
+        f32 Dequantise(s32 in_value);
+        //------------------------------------------------------------
+        /// Writes the delta between a snapshot and its baseline.
+        ///
+        /// @param The snapshot.
+        /// @param The baseline the receiver has acknowledged.
+        /// @param [Out] The writer.
+        //------------------------------------------------------------
+        void Encode(const Snapshot& in_snapshot, const Snapshot& in_baseline, BitWriter& out_writer);
+        //------------------------------------------------------------
+        /// Reconstructs a snapshot from a delta and its baseline.
+        ///
+        /// @param The reader.
+        /// @param The baseline the delta was encoded against.
+        /// @param The tick of the snapshot.
+        /// @param [Out] The snapshot.
+        ///
+        /// @return Whether the delta was read without overflow.
+        //------------------------------------------------------------
+        bool Decode(BitReader& in_reader, const Snapshot& in_baseline, u32 in_tick, Snapshot& out_snapshot);
+    }
+}
+
+#endif
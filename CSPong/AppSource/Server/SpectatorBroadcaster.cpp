@@ -0,0 +1,194 @@
+//
+//  SpectatorBroadcaster.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/SpectatorBroadcaster.h>
+
+#include <Server/BitStream.h>
+#include <Server/MatchScheduler.h>
+#include <Server/MatchSimulation.h>
+#include <Server/ServerProtocol.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    SpectatorBroadcaster::SpectatorBroadcaster(UdpSocket* in_socket)
+    : m_socket(in_socket)
+    {
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 SpectatorBroadcaster::AddSpectator(const UdpSocket::Address& in_address, u32 in_matchId)
+    {
+        u32 spectatorId = u32(m_spectators.size());
+
+        Spectator spectator;
+        spectator.m_address = in_address;
+        spectator.m_matchId = in_matchId;
+        m_spectators.push_back(spectator);
+
+        auto feedIt = std::find_if(m_feeds.begin(), m_feeds.end(), [in_matchId](const MatchFeed& in_feed)
+        {
+            return in_feed.m_matchId == in_matchId;
+        });
+
+        if (feedIt == m_feeds.end())
+        {
+            MatchFeed feed;
+            feed.m_matchId = in_matchId;
+            m_feeds.push_back(feed);
+            feedIt = m_feeds.end() - 1;
+        }
+
+        feedIt->m_spectatorIds.push_back(spectatorId);
+        return spectatorId;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void SpectatorBroadcaster::OnAck(const UdpSocket::Address& in_address, u32 in_spectatorId, u32 in_tick)
+    {
+        if (in_spectatorId >= m_spectators.size())
+        {
+            return;
+        }
+
+        Spectator& spectator = m_spectators[in_spectatorId];
+        if (spectator.m_address.m_ip == in_address.m_ip && spectator.m_address.m_port == in_address.m_port)
+        {
+            spectator.m_ackedTick = std::max(spectator.m_ackedTick, in_tick);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void SpectatorBroadcaster::Broadcast(const MatchScheduler& in_scheduler)
+    {
+        for (auto& feed : m_feeds)
+        {
+            const MatchSimulation* match = in_scheduler.GetMatch(feed.m_matchId);
+
+            //Tick zero is reserved for the zero baseline.
+            if (match == nullptr || match->GetTickCount() == 0 || match->GetTickCount() == feed.m_history[feed.m_historyHead].m_tick)
+            {
+                continue;
+            }
+
+            feed.m_historyHead = (feed.m_historyHead + 1) % k_historySize;
+            feed.m_history[feed.m_historyHead] = SnapshotEncoder::Quantise(*match);
+
+            SendFeed(feed, feed.m_history[feed.m_historyHead]);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 SpectatorBroadcaster::GetNumSpectators() const
+    {
+        return u32(m_spectators.size());
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    const SpectatorBroadcaster::Stats& SpectatorBroadcaster::GetStats() const
+    {
+        return m_stats;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    const Snapshot* SpectatorBroadcaster::FindBaseline(const MatchFeed& in_feed, u32 in_tick) const
+    {
+        if (in_tick == 0)
+        {
+            return nullptr;
+        }
+
+        for (const auto& snapshot : in_feed.m_history)
+        {
+            if (snapshot.m_tick == in_tick)
+            {
+                return &snapshot;
+            }
+        }
+
+        return nullptr;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void SpectatorBroadcaster::SendFeed(MatchFeed& in_feed, const Snapshot& in_snapshot)
+    {
+        m_groupScratch = in_feed.m_spectatorIds;
+        std::sort(m_groupScratch.begin(), m_groupScratch.end(), [this](u32 in_a, u32 in_b)
+        {
+            return m_spectators[in_a].m_ackedTick < m_spectators[in_b].m_ackedTick;
+        });
+
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+
+        u32 groupStart = 0;
+        while (groupStart < m_groupScratch.size())
+        {
+            u32 ackedTick = m_spectators[m_groupScratch[groupStart]].m_ackedTick;
+
+            u32 groupEnd = groupStart + 1;
+            while (groupEnd < m_groupScratch.size() && m_spectators[m_groupScratch[groupEnd]].m_ackedTick == ackedTick)
+            {
+                ++groupEnd;
+            }
+
+            //Encode once for everyone that shares this baseline.
+            auto encodeStart = std::chrono::steady_clock::now();
+
+            const Snapshot* baseline = FindBaseline(in_feed, ackedTick);
+            u32 baselineTick = (baseline != nullptr) ? baseline->m_tick : 0;
+
+            ServerProtocol::PacketWriter header(buffer);
+            header.Write(ServerProtocol::PacketType::k_snapshot);
+            header.Write(in_feed.m_matchId);
+            header.Write(in_snapshot.m_tick);
+            header.Write(baselineTick);
+
+            BitWriter writer(buffer + header.GetSize(), ServerProtocol::k_maxPacketSize - header.GetSize());
+            SnapshotEncoder::Encode(in_snapshot, (baseline != nullptr) ? *baseline : m_zeroBaseline, writer);
+            u32 packetSize = header.GetSize() + writer.GetSize();
+
+            m_stats.m_encodeSeconds += std::chrono::duration<f64>(std::chrono::steady_clock::now() - encodeStart).count();
+            m_stats.m_encodes++;
+
+            for (u32 i = groupStart; i < groupEnd; ++i)
+            {
+                m_socket->Send(m_spectators[m_groupScratch[i]].m_address, buffer, packetSize);
+
+                m_stats.m_snapshotsSent++;
+                m_stats.m_deltaBytesSent += packetSize;
+                m_stats.m_naiveBytes += ServerProtocol::k_fullStatePacketSize;
+            }
+
+            groupStart = groupEnd;
+        }
+    }
+}
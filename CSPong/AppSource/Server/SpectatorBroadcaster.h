@@ -0,0 +1,155 @@
+//
+//  SpectatorBroadcaster.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_SPECTATORBROADCASTER_H_
+#define _APPSOURCE_SERVER_SPECTATORBROADCASTER_H_
+
+#include <ForwardDeclarations.h>
+
+#include <Server/SnapshotEncoder.h>
+#include <Server/UdpSocket.h>
+
+#include <array>
+#include <vector>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// Streams delta compressed match snapshots to spectators.
+    ///
+    /// Each spectator acknowledges the snapshots it receives and
+    /// is sent deltas against the latest one it acknowledged.
+    /// Spectators of a match are grouped by that baseline so each
+    /// distinct delta is encoded once and the same bytes are sent
+    /// to every spectator in the group. Spectators whose baseline
+    /// has fallen out of the snapshot history receive a full
+    /// snapshot, which is a delta against the zero baseline.
+    ///
+    /// Encode cost and bandwidth are tracked against the naive
+    /// alternative of sending a full uncompressed state packet to
+    /// every spectator every time.
+    //------------------------------------------------------------
+    class SpectatorBroadcaster final
+    {
+    public:
+        static const u32 k_historySize = 32;
+        //------------------------------------------------------------
+        /// Running totals used to compare the delta stream to
+        /// naive full snapshots.
+        //------------------------------------------------------------
+        struct Stats
+        {
+            u64 m_snapshotsSent = 0;
+            u64 m_deltaBytesSent = 0;
+            u64 m_naiveBytes = 0;
+            u64 m_encodes = 0;
+            f64 m_encodeSeconds = 0.0;
+        };
+        //------------------------------------------------------------
+        /// @param The socket to send snapshots on.
+        //------------------------------------------------------------
+        SpectatorBroadcaster(UdpSocket* in_socket);
+        //------------------------------------------------------------
+        /// @param The address of the spectator.
+        /// @param The match to watch.
+        ///
+        /// @return The spectator id.
+        //------------------------------------------------------------
+        u32 AddSpectator(const UdpSocket::Address& in_address, u32 in_matchId);
+        //------------------------------------------------------------
+        /// Records that a spectator has received a snapshot.
+        ///
+        /// @param The address the acknowledgement came from.
+        /// @param The spectator id.
+        /// @param The tick of the received snapshot.
+        //------------------------------------------------------------
+        void OnAck(const UdpSocket::Address& in_address, u32 in_spectatorId, u32 in_tick);
+        //------------------------------------------------------------
+        /// Snapshots every watched match and sends the deltas.
+        /// Must only be called while the scheduler is between
+        /// batches.
+        ///
+        /// @param The scheduler holding the matches.
+        //------------------------------------------------------------
+        void Broadcast(const MatchScheduler& in_scheduler);
+        //------------------------------------------------------------
+        /// @return The number of spectators.
+        //------------------------------------------------------------
+        u32 GetNumSpectators() const;
+        //------------------------------------------------------------
+        /// @return The running totals.
+        //------------------------------------------------------------
+        const Stats& GetStats() const;
+
+    private:
+        //------------------------------------------------------------
+        /// A spectator and the last snapshot it acknowledged.
+        //------------------------------------------------------------
+        struct Spectator
+        {
+            UdpSocket::Address m_address;
+            u32 m_matchId = 0;
+            u32 m_ackedTick = 0;
+        };
+        //------------------------------------------------------------
+        /// The recent snapshots of a watched match and the
+        /// spectators watching it.
+        //------------------------------------------------------------
+        struct MatchFeed
+        {
+            u32 m_matchId = 0;
+            std::array<Snapshot, k_historySize> m_history;
+            u32 m_historyHead = 0;
+            std::vector<u32> m_spectatorIds;
+        };
+        //------------------------------------------------------------
+        /// @param The feed.
+        /// @param The tick of the baseline.
+        ///
+        /// @return The snapshot with the given tick, or null if it
+        /// is no longer in the history.
+        //------------------------------------------------------------
+        const Snapshot* FindBaseline(const MatchFeed& in_feed, u32 in_tick) const;
+        //------------------------------------------------------------
+        /// Encodes and sends the latest snapshot of a feed.
+        ///
+        /// @param The feed.
+        /// @param The latest snapshot.
+        //------------------------------------------------------------
+        void SendFeed(MatchFeed& in_feed, const Snapshot& in_snapshot);
+
+        UdpSocket* m_socket;
+        std::vector<Spectator> m_spectators;
+        std::vector<MatchFeed> m_feeds;
+        std::vector<u32> m_groupScratch;
+        Snapshot m_zeroBaseline;
+        Stats m_stats;
+    };
+}
+
+#endif
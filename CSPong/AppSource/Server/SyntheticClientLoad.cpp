@@ -0,0 +1,232 @@
+//
+//  SyntheticClientLoad.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/SyntheticClientLoad.h>
+
+#include <Server/BitStream.h>
+#include <Server/ServerProtocol.h>
+
+#include <ChilliSource/Core/Math.h>
+
+#include <cmath>
+
+namespace CSPong
+{
+    namespace
+    {
+        const f32 k_targetFrequency = 0.5f;
+    }
+
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    SyntheticClientLoad::SyntheticClientLoad(const UdpSocket::Address& in_serverAddress, f32 in_targetRange)
+    : m_serverAddress(in_serverAddress), m_targetRange(in_targetRange)
+    {
+        m_socket.Bind(0);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void SyntheticClientLoad::AddClients(u32 in_numClients)
+    {
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+
+        for (u32 i = 0; i < in_numClients; ++i)
+        {
+            u32 token = u32(m_clients.size());
+
+            Client client;
+            client.m_phase = CS::Random::Generate(0.0f, CS::MathUtils::k_pi * 2.0f);
+            m_clients.push_back(client);
+
+            ServerProtocol::PacketWriter writer(buffer);
+            writer.Write(ServerProtocol::PacketType::k_join);
+            writer.Write(token);
+            m_socket.Send(m_serverAddress, buffer, writer.GetSize());
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void SyntheticClientLoad::AddSpectators(u32 in_numSpectators, u32 in_numMatches)
+    {
+        CS_ASSERT(in_numMatches > 0, "Spectators need at least one match to watch.");
+
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+
+        for (u32 i = 0; i < in_numSpectators; ++i)
+        {
+            u32 token = u32(m_spectators.size());
+
+            Spectator spectator;
+            spectator.m_socket = UdpSocketUPtr(new UdpSocket());
+            spectator.m_socket->Bind(0);
+
+            ServerProtocol::PacketWriter writer(buffer);
+            writer.Write(ServerProtocol::PacketType::k_spectate);
+            writer.Write(token);
+            writer.Write(token % in_numMatches);
+            spectator.m_socket->Send(m_serverAddress, buffer, writer.GetSize());
+
+            m_spectators.push_back(std::move(spectator));
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void SyntheticClientLoad::Update(f32 in_timeSinceLastUpdate)
+    {
+        m_time += in_timeSinceLastUpdate;
+
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+        UdpSocket::Address address;
+
+        u32 size = m_socket.Receive(buffer, ServerProtocol::k_maxPacketSize, address);
+        while (size > 0)
+        {
+            m_bytesReceived += size;
+
+            ServerProtocol::PacketReader reader(buffer, size);
+            ServerProtocol::PacketType type;
+            u32 token;
+            u32 clientId;
+            if (reader.Read(type) == true && type == ServerProtocol::PacketType::k_joined && reader.Read(token) == true && reader.Read(clientId) == true && token < m_clients.size())
+            {
+                if (m_clients[token].m_joined == false)
+                {
+                    m_clients[token].m_joined = true;
+                    m_clients[token].m_clientId = clientId;
+                    ++m_numJoined;
+                }
+            }
+
+            size = m_socket.Receive(buffer, ServerProtocol::k_maxPacketSize, address);
+        }
+
+        for (auto& spectator : m_spectators)
+        {
+            UpdateSpectator(spectator);
+        }
+
+        for (const auto& client : m_clients)
+        {
+            if (client.m_joined == true)
+            {
+                f32 targetY = std::sin(m_time * k_targetFrequency * CS::MathUtils::k_pi * 2.0f + client.m_phase) * m_targetRange * 0.5f;
+
+                ServerProtocol::PacketWriter writer(buffer);
+                writer.Write(ServerProtocol::PacketType::k_input);
+                writer.Write(client.m_clientId);
+                writer.Write(targetY);
+                m_socket.Send(m_serverAddress, buffer, writer.GetSize());
+            }
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void SyntheticClientLoad::UpdateSpectator(Spectator& in_spectator)
+    {
+        u8 buffer[ServerProtocol::k_maxPacketSize];
+        UdpSocket::Address address;
+
+        u32 size = in_spectator.m_socket->Receive(buffer, ServerProtocol::k_maxPacketSize, address);
+        while (size > 0)
+        {
+            m_bytesReceived += size;
+
+            ServerProtocol::PacketReader reader(buffer, size);
+            ServerProtocol::PacketType type;
+            if (reader.Read(type) == true)
+            {
+                if (type == ServerProtocol::PacketType::k_spectating)
+                {
+                    u32 token;
+                    if (reader.Read(token) == true && reader.Read(in_spectator.m_spectatorId) == true)
+                    {
+                        in_spectator.m_joined = true;
+                    }
+                }
+                else if (type == ServerProtocol::PacketType::k_snapshot && in_spectator.m_joined == true)
+                {
+                    u32 matchId;
+                    u32 tick;
+                    u32 baselineTick;
+                    if (reader.Read(matchId) == true && reader.Read(tick) == true && reader.Read(baselineTick) == true)
+                    {
+                        //Tick zero is the zero baseline, which is never stored in the history.
+                        const Snapshot zeroBaseline;
+                        const Snapshot* baseline = (baselineTick == 0) ? &zeroBaseline : nullptr;
+                        for (u32 i = 0; i < in_spectator.m_history.size() && baseline == nullptr; ++i)
+                        {
+                            if (in_spectator.m_history[i].m_tick == baselineTick)
+                            {
+                                baseline = &in_spectator.m_history[i];
+                            }
+                        }
+
+                        const u32 k_headerSize = 1 + 4 + 4 + 4;
+                        BitReader bitReader(buffer + k_headerSize, size - k_headerSize);
+                        Snapshot decoded;
+                        if (baseline == nullptr || SnapshotEncoder::Decode(bitReader, *baseline, tick, decoded) == false)
+                        {
+                            ++m_snapshotDecodeFailures;
+                        }
+                        else
+                        {
+                            in_spectator.m_historyHead = (in_spectator.m_historyHead + 1) % in_spectator.m_history.size();
+                            in_spectator.m_history[in_spectator.m_historyHead] = decoded;
+
+                            ServerProtocol::PacketWriter writer(buffer);
+                            writer.Write(ServerProtocol::PacketType::k_ack);
+                            writer.Write(in_spectator.m_spectatorId);
+                            writer.Write(tick);
+                            in_spectator.m_socket->Send(m_serverAddress, buffer, writer.GetSize());
+                        }
+                    }
+                }
+            }
+
+            size = in_spectator.m_socket->Receive(buffer, ServerProtocol::k_maxPacketSize, address);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 SyntheticClientLoad::GetNumJoinedClients() const
+    {
+        return m_numJoined;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u64 SyntheticClientLoad::GetBytesReceived() const
+    {
+        return m_bytesReceived;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 SyntheticClientLoad::GetSnapshotDecodeFailures() const
+    {
+        return m_snapshotDecodeFailures;
+    }
+}
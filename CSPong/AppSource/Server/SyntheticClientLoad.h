@@ -0,0 +1,144 @@
+//
+//  SyntheticClientLoad.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_SYNTHETICCLIENTLOAD_H_
+#define _APPSOURCE_SERVER_SYNTHETICCLIENTLOAD_H_
+
+#include <ForwardDeclarations.h>
+
+#include <Server/SnapshotEncoder.h>
+#include <Server/SpectatorBroadcaster.h>
+#include <Server/UdpSocket.h>
+
+#include <array>
+#include <vector>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// Simulates many remote players connecting to a local
+    /// dedicated server. All clients share a single socket and
+    /// are told apart by the token they join with. Each joined
+    /// client moves its paddle target along its own sine wave
+    /// and sends it to the server every update.
+    ///
+    /// Spectators each use their own socket, as separate viewers
+    /// would. They decode every snapshot against their own
+    /// history and acknowledge it, exercising the full delta
+    /// stream.
+    //------------------------------------------------------------
+    class SyntheticClientLoad final
+    {
+    public:
+        //------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @param The address of the server.
+        /// @param The height the paddle targets move within.
+        //------------------------------------------------------------
+        SyntheticClientLoad(const UdpSocket::Address& in_serverAddress, f32 in_targetRange);
+        //------------------------------------------------------------
+        /// Adds clients and sends their join requests.
+        ///
+        /// @param The number of clients to add.
+        //------------------------------------------------------------
+        void AddClients(u32 in_numClients);
+        //------------------------------------------------------------
+        /// Adds spectators, each watching one of the given matches.
+        ///
+        /// @param The number of spectators to add.
+        /// @param The number of matches to spread them across,
+        /// starting from match zero.
+        //------------------------------------------------------------
+        void AddSpectators(u32 in_numSpectators, u32 in_numMatches);
+        //------------------------------------------------------------
+        /// Reads all server packets then sends fresh input for
+        /// every joined client.
+        ///
+        /// @param The time since the last update in seconds.
+        //------------------------------------------------------------
+        void Update(f32 in_timeSinceLastUpdate);
+        //------------------------------------------------------------
+        /// @return The number of clients the server has accepted.
+        //------------------------------------------------------------
+        u32 GetNumJoinedClients() const;
+        //------------------------------------------------------------
+        /// @return The total number of state bytes received.
+        //------------------------------------------------------------
+        u64 GetBytesReceived() const;
+        //------------------------------------------------------------
+        /// @return The number of snapshots that could not be
+        /// decoded, either because of a corrupt delta or a missing
+        /// baseline. Should always be zero.
+        //------------------------------------------------------------
+        u32 GetSnapshotDecodeFailures() const;
+
+    private:
+        //------------------------------------------------------------
+        /// A simulated player.
+        //------------------------------------------------------------
+        struct Client
+        {
+            u32 m_clientId = 0;
+            f32 m_phase = 0.0f;
+            bool m_joined = false;
+        };
+
+        //------------------------------------------------------------
+        /// A simulated viewer.
+        //------------------------------------------------------------
+        struct Spectator
+        {
+            UdpSocketUPtr m_socket;
+            u32 m_spectatorId = 0;
+            bool m_joined = false;
+            std::array<Snapshot, SpectatorBroadcaster::k_historySize> m_history;
+            u32 m_historyHead = 0;
+        };
+        //------------------------------------------------------------
+        /// Reads and acknowledges every pending packet for a
+        /// spectator.
+        ///
+        /// @param The spectator.
+        //------------------------------------------------------------
+        void UpdateSpectator(Spectator& in_spectator);
+
+        UdpSocket::Address m_serverAddress;
+        UdpSocket m_socket;
+        f32 m_targetRange;
+        f32 m_time = 0.0f;
+
+        std::vector<Client> m_clients;
+        std::vector<Spectator> m_spectators;
+        u32 m_numJoined = 0;
+        u32 m_snapshotDecodeFailures = 0;
+        u64 m_bytesReceived = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,180 @@
+//
+//  UdpSocket.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Server/UdpSocket.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#ifdef CS_TARGETPLATFORM_WINDOWS
+#include <winsock2.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+namespace CSPong
+{
+    namespace
+    {
+        const s64 k_invalidHandle = -1;
+    }
+
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    UdpSocket::UdpSocket()
+    : m_handle(k_invalidHandle)
+    {
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        WSADATA wsaData;
+        WSAStartup(MAKEWORD(2, 2), &wsaData);
+
+        SOCKET handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (handle != INVALID_SOCKET)
+        {
+            u_long nonBlocking = 1;
+            ioctlsocket(handle, FIONBIO, &nonBlocking);
+            m_handle = s64(handle);
+        }
+#else
+        int handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (handle >= 0)
+        {
+            fcntl(handle, F_SETFL, fcntl(handle, F_GETFL, 0) | O_NONBLOCK);
+            m_handle = s64(handle);
+        }
+#endif
+
+        if (m_handle == k_invalidHandle)
+        {
+            CS_LOG_ERROR("Could not open UDP socket.");
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    UdpSocket::~UdpSocket()
+    {
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        if (m_handle != k_invalidHandle)
+        {
+            closesocket(SOCKET(m_handle));
+        }
+        WSACleanup();
+#else
+        if (m_handle != k_invalidHandle)
+        {
+            close(int(m_handle));
+        }
+#endif
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    bool UdpSocket::Bind(u16 in_port)
+    {
+        if (m_handle == k_invalidHandle)
+        {
+            return false;
+        }
+
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(in_port);
+
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        bool bound = bind(SOCKET(m_handle), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+#else
+        bool bound = bind(int(m_handle), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+#endif
+
+        if (bound == false)
+        {
+            CS_LOG_ERROR("Could not bind UDP socket to port " + CS::ToString(u32(in_port)));
+        }
+
+        return bound;
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    bool UdpSocket::Send(const Address& in_address, const u8* in_data, u32 in_size)
+    {
+        if (m_handle == k_invalidHandle)
+        {
+            return false;
+        }
+
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(in_address.m_ip);
+        address.sin_port = htons(in_address.m_port);
+
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        int sent = sendto(SOCKET(m_handle), reinterpret_cast<const char*>(in_data), int(in_size), 0, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+#else
+        ssize_t sent = sendto(int(m_handle), in_data, in_size, 0, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+#endif
+
+        return sent == s64(in_size);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    u32 UdpSocket::Receive(u8* out_buffer, u32 in_bufferSize, Address& out_address)
+    {
+        if (m_handle == k_invalidHandle)
+        {
+            return 0;
+        }
+
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        int addressSize = sizeof(address);
+        int received = recvfrom(SOCKET(m_handle), reinterpret_cast<char*>(out_buffer), int(in_bufferSize), 0, reinterpret_cast<sockaddr*>(&address), &addressSize);
+#else
+        socklen_t addressSize = sizeof(address);
+        ssize_t received = recvfrom(int(m_handle), out_buffer, in_bufferSize, 0, reinterpret_cast<sockaddr*>(&address), &addressSize);
+#endif
+
+        if (received <= 0)
+        {
+            return 0;
+        }
+
+        out_address.m_ip = ntohl(address.sin_addr.s_addr);
+        out_address.m_port = ntohs(address.sin_port);
+        return u32(received);
+    }
+}
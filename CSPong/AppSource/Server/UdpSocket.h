@@ -0,0 +1,98 @@
+//
+//  UdpSocket.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SERVER_UDPSOCKET_H_
+#define _APPSOURCE_SERVER_UDPSOCKET_H_
+
+#include <ForwardDeclarations.h>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// A minimal non-blocking IPv4 UDP socket used by the
+    /// dedicated server and its synthetic clients. Addresses are
+    /// in host byte order.
+    //------------------------------------------------------------
+    class UdpSocket final
+    {
+    public:
+        static const u32 k_loopbackAddress = 0x7f000001;
+        //------------------------------------------------------------
+        /// An IPv4 address and port.
+        //------------------------------------------------------------
+        struct Address
+        {
+            u32 m_ip = 0;
+            u16 m_port = 0;
+        };
+        //------------------------------------------------------------
+        /// Opens the socket.
+        //------------------------------------------------------------
+        UdpSocket();
+        //------------------------------------------------------------
+        /// Closes the socket.
+        //------------------------------------------------------------
+        ~UdpSocket();
+        //------------------------------------------------------------
+        /// Binds the socket to the given port on all interfaces.
+        ///
+        /// @param The port, or zero for any free port.
+        ///
+        /// @return Whether the socket was bound.
+        //------------------------------------------------------------
+        bool Bind(u16 in_port);
+        //------------------------------------------------------------
+        /// @param The destination.
+        /// @param The data to send.
+        /// @param The size of the data in bytes.
+        ///
+        /// @return Whether the datagram was sent.
+        //------------------------------------------------------------
+        bool Send(const Address& in_address, const u8* in_data, u32 in_size);
+        //------------------------------------------------------------
+        /// Reads the next pending datagram, if any, without
+        /// blocking.
+        ///
+        /// @param [Out] The buffer to read into.
+        /// @param The size of the buffer in bytes.
+        /// @param [Out] The address the datagram came from.
+        ///
+        /// @return The size of the datagram or zero if there were
+        /// none pending.
+        //------------------------------------------------------------
+        u32 Receive(u8* out_buffer, u32 in_bufferSize, Address& out_address);
+
+    private:
+        UdpSocket(const UdpSocket&) = delete;
+        UdpSocket& operator=(const UdpSocket&) = delete;
+
+        s64 m_handle;
+    };
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <Splash/SplashState.h>
 
 #include <Common/TransitionSystem.h>
+#include <Common/TweenSystem.h>
 #include <MainMenu/MainMenuState.h>
 
 #include <ChilliSource/Core/Base.h>
@@ -105,7 +106,8 @@ namespace CSPong
          Next: 'GUI' in MainMenuState::OnInit
          */
         
-        m_transitionSystem = CreateSystem<TransitionSystem>(0.0f, 1.0f);
+        auto tweenSystem = CreateSystem<TweenSystem>();
+        m_transitionSystem = CreateSystem<TransitionSystem>(tweenSystem, 0.0f, 1.0f);
     }
     //------------------------------------------------------------
     //------------------------------------------------------------
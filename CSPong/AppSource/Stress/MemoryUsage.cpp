@@ -0,0 +1,89 @@
+//
+//  MemoryUsage.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Stress/MemoryUsage.h>
+
+#if defined(CS_TARGETPLATFORM_WINDOWS)
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#elif defined(CS_TARGETPLATFORM_IOS)
+#include <mach/mach.h>
+#else
+#include <cstdio>
+#include <unistd.h>
+#endif
+
+namespace CSPong
+{
+    namespace MemoryUsage
+    {
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        u64 GetResidentBytes()
+        {
+#if defined(CS_TARGETPLATFORM_WINDOWS)
+            PROCESS_MEMORY_COUNTERS counters;
+            if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+            {
+                return 0;
+            }
+
+            return u64(counters.WorkingSetSize);
+#elif defined(CS_TARGETPLATFORM_IOS)
+            mach_task_basic_info info;
+            mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+            if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+            {
+                return 0;
+            }
+
+            return u64(info.resident_size);
+#else
+            //The second field of statm is the resident set size in pages.
+            FILE* file = std::fopen("/proc/self/statm", "r");
+            if (file == nullptr)
+            {
+                return 0;
+            }
+
+            unsigned long totalPages = 0;
+            unsigned long residentPages = 0;
+            int numRead = std::fscanf(file, "%lu %lu", &totalPages, &residentPages);
+            std::fclose(file);
+
+            if (numRead != 2)
+            {
+                return 0;
+            }
+
+            return u64(residentPages) * u64(sysconf(_SC_PAGESIZE));
+#endif
+        }
+    }
+}
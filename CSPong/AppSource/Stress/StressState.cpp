@@ -0,0 +1,214 @@
+//
+//  StressState.cpp
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Stress/StressState.h>
+
+#include <Game/GameEntityFactory.h>
+#include <Game/ScoringSystem.h>
+#include <Game/Ball/BallControllerComponent.h>
+#include <Game/Physics/PhysicsSystem.h>
+#include <Stress/MemoryUsage.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Delegate.h>
+#include <ChilliSource/Core/Entity.h>
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/Scene.h>
+
+#include <algorithm>
+
+namespace CSPong
+{
+    namespace
+    {
+        const u32 k_maxBalls = 10000;
+        const f32 k_rampInterval = 5.0f;
+        const CS::Vector2 k_spawnExtents(20.0f, 15.0f);
+    }
+
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    StressState::StressState(Mode in_mode)
+    : m_mode(in_mode)
+    {
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::CreateSystems()
+    {
+        m_physicsSystem = CreateSystem<PhysicsSystem>();
+        m_scoringSystem = CreateSystem<ScoringSystem>();
+        m_gameEntityFactory = CreateSystem<GameEntityFactory>(m_physicsSystem, m_scoringSystem);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::OnInit()
+    {
+        GetMainScene()->SetClearColour(CS::Colour::k_black);
+        
+        if (m_mode == Mode::k_rendered)
+        {
+            GetMainScene()->Add(m_gameEntityFactory->CreateCamera());
+            GetMainScene()->Add(m_gameEntityFactory->CreateAmbientLight());
+            GetMainScene()->Add(m_gameEntityFactory->CreateDiffuseLight());
+        }
+        
+        GetMainScene()->Add(m_gameEntityFactory->CreateArena());
+        
+        m_ballScoredConnection = m_scoringSystem->GetBallScoredEvent().OpenConnection(CS::MakeDelegate(this, &StressState::OnBallScored));
+        
+        SpawnBalls(1);
+        
+        m_oppositionPaddle = m_gameEntityFactory->AcquireOppositionPaddle(m_balls.front());
+        GetMainScene()->Add(m_oppositionPaddle);
+        
+        m_physicsSystem->ResetStepStats();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::OnUpdate(f32 in_timeSinceLastUpdate)
+    {
+        RecycleScoredBalls();
+        
+        m_numFrames++;
+        m_totalFrameSeconds += in_timeSinceLastUpdate;
+        m_maxFrameSeconds = std::max(m_maxFrameSeconds, f64(in_timeSinceLastUpdate));
+        
+        m_rampTimer += in_timeSinceLastUpdate;
+        if (m_rampTimer >= k_rampInterval)
+        {
+            m_rampTimer = 0.0f;
+            ReportStep();
+            
+            if (m_balls.size() < k_maxBalls)
+            {
+                SpawnBalls(std::min(u32(m_balls.size()) * 2, k_maxBalls));
+            }
+            else if (m_isComplete == false)
+            {
+                m_isComplete = true;
+                CS_LOG_VERBOSE("Stress test reached " + CS::ToString(k_maxBalls) + " balls.");
+            }
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::OnDestroy()
+    {
+        m_ballScoredConnection.reset();
+        
+        m_gameEntityFactory->ReleaseOppositionPaddle(m_oppositionPaddle);
+        m_oppositionPaddle.reset();
+        
+        for (const auto& ball : m_balls)
+        {
+            m_gameEntityFactory->ReleaseBall(ball);
+        }
+        
+        m_balls.clear();
+        m_scoredBalls.clear();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::OnBallScored(CS::Entity* in_ball, u32 in_playerIndex)
+    {
+        if (std::find(m_scoredBalls.begin(), m_scoredBalls.end(), in_ball) != m_scoredBalls.end())
+        {
+            return;
+        }
+        
+        in_ball->GetComponent<BallControllerComponent>()->Deactivate();
+        m_scoredBalls.push_back(in_ball);
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::SpawnBalls(u32 in_targetCount)
+    {
+        m_gameEntityFactory->WarmPools(in_targetCount - u32(m_balls.size()), 1);
+        m_balls.reserve(in_targetCount);
+        
+        while (m_balls.size() < in_targetCount)
+        {
+            CS::EntitySPtr ball = m_gameEntityFactory->AcquireBall();
+            ball->GetComponent<BallControllerComponent>()->SetSlot(u32(m_balls.size()));
+            m_balls.push_back(ball);
+            
+            ServeBall(ball);
+        }
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::ServeBall(const CS::EntitySPtr& in_ball)
+    {
+        f32 x = CS::Random::Generate(-k_spawnExtents.x, k_spawnExtents.x);
+        f32 y = CS::Random::Generate(-k_spawnExtents.y, k_spawnExtents.y);
+        in_ball->GetTransform().SetPosition(x, y, 0.0f);
+        
+        GetMainScene()->Add(in_ball);
+        in_ball->GetComponent<BallControllerComponent>()->Activate();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::RecycleScoredBalls()
+    {
+        for (CS::Entity* scoredBall : m_scoredBalls)
+        {
+            u32 index = scoredBall->GetComponent<BallControllerComponent>()->GetSlot();
+            CS_ASSERT(index < m_balls.size() && m_balls[index].get() == scoredBall, "Scored ball was not spawned by the stress test.");
+            
+            m_gameEntityFactory->ReleaseBall(m_balls[index]);
+            
+            CS::EntitySPtr ball = m_gameEntityFactory->AcquireBall();
+            ball->GetComponent<BallControllerComponent>()->SetSlot(index);
+            m_balls[index] = ball;
+            
+            ServeBall(ball);
+            m_numRecycled++;
+        }
+        
+        m_scoredBalls.clear();
+    }
+    //------------------------------------------------------------
+    //------------------------------------------------------------
+    void StressState::ReportStep()
+    {
+        const PhysicsSystem::StepStats& stepStats = m_physicsSystem->GetStepStats();
+        
+        f64 averageFrameMs = (m_numFrames > 0) ? (m_totalFrameSeconds * 1000.0) / f64(m_numFrames) : 0.0;
+        f64 averageStepMs = (stepStats.m_numSteps > 0) ? (stepStats.m_totalSeconds * 1000.0) / f64(stepStats.m_numSteps) : 0.0;
+        f64 residentMegabytes = f64(MemoryUsage::GetResidentBytes()) / (1024.0 * 1024.0);
+        
+        CS_LOG_VERBOSE("Balls: " + CS::ToString(u32(m_balls.size())) + ", frame: " + CS::ToString(f32(averageFrameMs)) + " ms (max " + CS::ToString(f32(m_maxFrameSeconds * 1000.0)) + " ms), fixed step: " + CS::ToString(f32(averageStepMs)) + " ms (max " + CS::ToString(f32(stepStats.m_maxSeconds * 1000.0)) + " ms) over " + CS::ToString(stepStats.m_numSteps) + " steps, recycled: " + CS::ToString(m_numRecycled) + ", memory: " + CS::ToString(f32(residentMegabytes)) + " MB");
+        
+        m_numFrames = 0;
+        m_totalFrameSeconds = 0.0;
+        m_maxFrameSeconds = 0.0;
+        m_numRecycled = 0;
+        m_physicsSystem->ResetStepStats();
+    }
+}
@@ -0,0 +1,150 @@
+//
+//  StressState.h
+//  CSPong
+//  Created by Tag Games on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_STRESS_STRESSSTATE_H_
+#define _APPSOURCE_STRESS_STRESSSTATE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/State.h>
+
+#include <vector>
+
+namespace CSPong
+{
+    //------------------------------------------------------------
+    /// A game mode used as the standard load test for the
+    /// physics, ball and scoring code. Pooled balls are spawned
+    /// into the arena, doubling in number at a fixed interval up
+    /// to 10,000. Goals never end the rally; the ball that
+    /// scored is released back to the pool and a ball is
+    /// re-acquired and served in its place.
+    ///
+    /// At the end of each step of the ramp the average and worst
+    /// frame time, the average and worst physics fixed step time
+    /// and the resident memory of the process are logged.
+    ///
+    /// The rendered mode is reached from the main menu when
+    /// CSPONG_STRESS_TEST is defined. The headless mode is the
+    /// initial state when CSPONG_STRESS_BENCHMARK is defined; it
+    /// adds no camera or lights so nothing in the scene is drawn.
+    //------------------------------------------------------------
+    class StressState final : public CS::State
+    {
+    public:
+        //------------------------------------------------------------
+        /// Whether the scene is drawn.
+        //------------------------------------------------------------
+        enum class Mode
+        {
+            k_rendered,
+            k_headless
+        };
+        //------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @param Whether the scene is drawn.
+        //------------------------------------------------------------
+        StressState(Mode in_mode);
+
+    private:
+        //------------------------------------------------------------
+        /// Creates the physics, scoring and entity factory systems
+        /// used by the game.
+        //------------------------------------------------------------
+        void CreateSystems() override;
+        //------------------------------------------------------------
+        /// Builds the arena and spawns the first step of balls.
+        //------------------------------------------------------------
+        void OnInit() override;
+        //------------------------------------------------------------
+        /// Recycles the balls that scored, records the frame time
+        /// and ramps the ball count.
+        ///
+        /// @param Time in seconds since last update
+        //------------------------------------------------------------
+        void OnUpdate(f32 in_timeSinceLastUpdate) override;
+        //------------------------------------------------------------
+        /// Returns every entity to the pools.
+        //------------------------------------------------------------
+        void OnDestroy() override;
+        //------------------------------------------------------------
+        /// Stops the ball and queues it to be recycled on the next
+        /// update, as the physics system is still iterating over
+        /// its bodies.
+        ///
+        /// @param The ball that scored.
+        /// @param The index of the player that scored.
+        //------------------------------------------------------------
+        void OnBallScored(CS::Entity* in_ball, u32 in_playerIndex);
+        //------------------------------------------------------------
+        /// Acquires balls until the target count is reached,
+        /// warming the pool first so acquiring does not allocate.
+        ///
+        /// @param The target number of balls.
+        //------------------------------------------------------------
+        void SpawnBalls(u32 in_targetCount);
+        //------------------------------------------------------------
+        /// Adds a ball to the scene at a random position near the
+        /// centre and serves it.
+        ///
+        /// @param The ball.
+        //------------------------------------------------------------
+        void ServeBall(const CS::EntitySPtr& in_ball);
+        //------------------------------------------------------------
+        /// Releases every ball that scored and serves a
+        /// re-acquired ball in its place.
+        //------------------------------------------------------------
+        void RecycleScoredBalls();
+        //------------------------------------------------------------
+        /// Logs the stats for the current step of the ramp then
+        /// resets them.
+        //------------------------------------------------------------
+        void ReportStep();
+
+        Mode m_mode;
+        
+        PhysicsSystem* m_physicsSystem = nullptr;
+        ScoringSystem* m_scoringSystem = nullptr;
+        GameEntityFactory* m_gameEntityFactory = nullptr;
+        
+        std::vector<CS::EntitySPtr> m_balls;
+        std::vector<CS::Entity*> m_scoredBalls;
+        CS::EntitySPtr m_oppositionPaddle;
+        CS::EventConnectionUPtr m_ballScoredConnection;
+        
+        f32 m_rampTimer = 0.0f;
+        u32 m_numFrames = 0;
+        f64 m_totalFrameSeconds = 0.0;
+        f64 m_maxFrameSeconds = 0.0;
+        u32 m_numRecycled = 0;
+        bool m_isComplete = false;
+    };
+}
+
+#endif
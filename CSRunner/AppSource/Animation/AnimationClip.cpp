@@ -0,0 +1,38 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Animation/AnimationClip.h>
+
+#include <ChilliSource/Core/Base.h>
+
+namespace CSRunner
+{
+    //------------------------------------------------------------
+    AnimationClip::AnimationClip(const std::string* frameAtlasIds, const u32* keyframes, u32 numKeyframes, f32 frameRate) noexcept
+    : m_frameAtlasIds(frameAtlasIds), m_keyframes(keyframes), m_numKeyframes(numKeyframes), m_frameTime(1.0f/frameRate)
+    {
+        CS_ASSERT(numKeyframes > 0, "Animation clip needs at least one frame.");
+        CS_ASSERT(frameRate > 0.0f, "Animation clip needs a positive frame rate.");
+    }
+}
@@ -0,0 +1,85 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ANIMATION_ANIMATIONCLIP_H_
+#define _APPSOURCE_ANIMATION_ANIMATIONCLIP_H_
+
+#include <ForwardDeclarations.h>
+
+#include <string>
+
+namespace CSRunner
+{
+    /// Immutable sequence of atlas frames played at a fixed rate. Clips are views into the
+    /// AnimationClipTable they were loaded from: each keyframe is an index into the table's
+    /// distinct frames, so players can tell whether a keyframe changes the image with an integer
+    /// compare. Clips hold no playback state and are shared between any number of sprites.
+    ///
+    class AnimationClip final
+    {
+    public:
+        
+        /// @param frameAtlasIds
+        ///     Atlas id of each distinct frame in the owning table
+        /// @param keyframes
+        ///     Distinct frame index of each keyframe
+        /// @param numKeyframes
+        ///     Number of keyframes, at least one
+        /// @param frameRate
+        ///     Used to calculate the time between frames
+        ///
+        AnimationClip(const std::string* frameAtlasIds, const u32* keyframes, u32 numKeyframes, f32 frameRate) noexcept;
+        
+        /// @return Number of keyframes in the clip
+        ///
+        u32 GetNumKeyframes() const noexcept { return m_numKeyframes; }
+        
+        /// @param keyframe
+        ///     Keyframe index
+        ///
+        /// @return Index of the distinct frame shown at that keyframe
+        ///
+        u32 GetFrame(u32 keyframe) const noexcept { return m_keyframes[keyframe]; }
+        
+        /// @param frame
+        ///     Distinct frame index, as returned by GetFrame()
+        ///
+        /// @return Atlas id of the frame
+        ///
+        const std::string& GetFrameAtlasId(u32 frame) const noexcept { return m_frameAtlasIds[frame]; }
+        
+        /// @return Time in seconds between keyframes
+        ///
+        f32 GetFrameTime() const noexcept { return m_frameTime; }
+        
+    private:
+        
+        const std::string* m_frameAtlasIds;
+        const u32* m_keyframes;
+        u32 m_numKeyframes;
+        f32 m_frameTime;
+    };
+}
+
+#endif
@@ -0,0 +1,147 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Animation/AnimationClipTable.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <Common/BinaryData.h>
+
+#include <cmath>
+
+namespace CSRunner
+{
+    CS_DEFINE_NAMEDTYPE(AnimationClipTable);
+    
+    namespace
+    {
+        const u32 k_fileId = 0x4C435343; //"CSCL"
+        const u32 k_fileVersion = 1;
+        
+        const u32 k_headerSize = 5 * sizeof(u32);
+        const u32 k_frameSize = 2 * sizeof(u32);
+        const u32 k_clipSize = 5 * sizeof(u32);
+    }
+    
+    //------------------------------------------------------------
+    AnimationClipTableUPtr AnimationClipTable::Create() noexcept
+    {
+        return AnimationClipTableUPtr(new AnimationClipTable());
+    }
+    
+    //------------------------------------------------------------
+    bool AnimationClipTable::IsA(CS::InterfaceIDType interfaceId) const noexcept
+    {
+        return interfaceId == AnimationClipTable::InterfaceID;
+    }
+    
+    //------------------------------------------------------------
+    bool AnimationClipTable::Build(std::unique_ptr<const u8[]> data, u32 dataSize) noexcept
+    {
+        using BinaryData::Read;
+        
+        const u8* bytes = data.get();
+        
+        if(dataSize < k_headerSize || Read<u32>(bytes, 0) != k_fileId || Read<u32>(bytes, 4) != k_fileVersion)
+        {
+            CS_LOG_ERROR("Animation clip table '" + GetName() + "' has an unrecognised header.");
+            return false;
+        }
+        
+        u32 numFrames = Read<u32>(bytes, 8);
+        u32 numClips = Read<u32>(bytes, 12);
+        u32 numKeyframes = Read<u32>(bytes, 16);
+        
+        BinaryData::SectionLayout layout(k_headerSize);
+        u32 framesOffset = layout.AddSection(numFrames, k_frameSize);
+        u32 clipsOffset = layout.AddSection(numClips, k_clipSize);
+        u32 keyframesOffset = layout.AddSection(numKeyframes, sizeof(u32));
+        if(layout.Fits(dataSize) == false)
+        {
+            CS_LOG_ERROR("Animation clip table '" + GetName() + "' is truncated.");
+            return false;
+        }
+        
+        u32 stringsOffset = layout.GetEnd();
+        m_frameAtlasIds.resize(numFrames);
+        for(u32 i = 0; i < numFrames; ++i)
+        {
+            if(BinaryData::TryReadString(bytes, dataSize, stringsOffset, framesOffset + i * k_frameSize, m_frameAtlasIds[i]) == false)
+            {
+                CS_LOG_ERROR("Animation clip table '" + GetName() + "' has an invalid frame name.");
+                return false;
+            }
+        }
+        
+        //Keyframes are read in place from the file data
+        const u32* keyframes = reinterpret_cast<const u32*>(bytes + keyframesOffset);
+        for(u32 i = 0; i < numKeyframes; ++i)
+        {
+            if(keyframes[i] >= numFrames)
+            {
+                CS_LOG_ERROR("Animation clip table '" + GetName() + "' has an invalid keyframe.");
+                return false;
+            }
+        }
+        
+        m_clipNames.resize(numClips);
+        m_clips.reserve(numClips);
+        for(u32 i = 0; i < numClips; ++i)
+        {
+            u32 clipOffset = clipsOffset + i * k_clipSize;
+            f32 frameRate = Read<f32>(bytes, clipOffset + 8);
+            u32 firstKeyframe = Read<u32>(bytes, clipOffset + 12);
+            u32 clipNumKeyframes = Read<u32>(bytes, clipOffset + 16);
+            if(clipNumKeyframes == 0 || BinaryData::IsRangeInBounds(firstKeyframe, clipNumKeyframes, numKeyframes) == false || (frameRate > 0.0f && std::isfinite(frameRate)) == false)
+            {
+                CS_LOG_ERROR("Animation clip table '" + GetName() + "' has an invalid clip.");
+                return false;
+            }
+            
+            if(BinaryData::TryReadString(bytes, dataSize, stringsOffset, clipOffset, m_clipNames[i]) == false)
+            {
+                CS_LOG_ERROR("Animation clip table '" + GetName() + "' has an invalid clip name.");
+                return false;
+            }
+            m_clips.push_back(AnimationClip(m_frameAtlasIds.data(), keyframes + firstKeyframe, clipNumKeyframes, frameRate));
+        }
+        
+        m_data = std::move(data);
+        return true;
+    }
+    
+    //------------------------------------------------------------
+    const AnimationClip* AnimationClipTable::GetClip(const std::string& name) const noexcept
+    {
+        for(u32 i = 0; i < u32(m_clipNames.size()); ++i)
+        {
+            if(m_clipNames[i] == name)
+            {
+                return &m_clips[i];
+            }
+        }
+        
+        return nullptr;
+    }
+}
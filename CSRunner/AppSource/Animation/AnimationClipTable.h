@@ -0,0 +1,89 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ANIMATION_ANIMATIONCLIPTABLE_H_
+#define _APPSOURCE_ANIMATION_ANIMATIONCLIPTABLE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Resource.h>
+
+#include <Animation/AnimationClip.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CSRunner
+{
+    /// Resource holding every animation clip built from a Clips.json by the content pipeline
+    /// (see animation_clip_builder.py). The binary table is read into a single buffer and the
+    /// clips index straight into it, with one string per distinct frame shared by every clip.
+    /// Loaded through the resource pool, so each table is loaded once and shared by all its users.
+    ///
+    class AnimationClipTable final : public CS::Resource
+    {
+    public:
+        
+        CS_DECLARE_NAMEDTYPE(AnimationClipTable);
+        
+        ///
+        bool IsA(CS::InterfaceIDType interfaceId) const noexcept override;
+        
+        /// Builds the table from the contents of a csclips file
+        ///
+        /// @param data
+        ///     File contents, which the table takes ownership of
+        /// @param dataSize
+        ///     Size of the data in bytes
+        ///
+        /// @return Whether the data was a valid clip table
+        ///
+        bool Build(std::unique_ptr<const u8[]> data, u32 dataSize) noexcept;
+        
+        /// @param name
+        ///     Name of the clip
+        ///
+        /// @return The clip with the given name, or null if there is none. Valid for the lifetime of the table.
+        ///
+        const AnimationClip* GetClip(const std::string& name) const noexcept;
+        
+    private:
+        
+        friend class CS::ResourcePool;
+        
+        ///
+        static AnimationClipTableUPtr Create() noexcept;
+        
+        ///
+        AnimationClipTable() = default;
+        
+        std::unique_ptr<const u8[]> m_data;
+        std::vector<std::string> m_frameAtlasIds;
+        std::vector<std::string> m_clipNames;
+        std::vector<AnimationClip> m_clips;
+    };
+}
+
+#endif
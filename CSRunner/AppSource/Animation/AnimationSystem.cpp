@@ -0,0 +1,231 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Animation/AnimationSystem.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Rendering/Sprite.h>
+
+#include <Animation/AnimationClip.h>
+
+#include <limits>
+
+#ifdef CSRUNNER_ANIMATION_STATS
+#include <chrono>
+#endif
+
+namespace CSRunner
+{
+    CS_DEFINE_NAMEDTYPE(AnimationSystem);
+    
+    namespace
+    {
+        const u32 k_noFrame = std::numeric_limits<u32>::max();
+        const u32 k_noInstance = std::numeric_limits<u32>::max();
+        
+#ifdef CSRUNNER_ANIMATION_STATS
+        constexpr f32 k_statsInterval = 5.0f;
+#endif
+    }
+    
+    //------------------------------------------------------------
+    AnimationSystemUPtr AnimationSystem::Create() noexcept
+    {
+        return AnimationSystemUPtr(new AnimationSystem());
+    }
+    
+    //------------------------------------------------------------
+    bool AnimationSystem::IsA(CS::InterfaceIDType interfaceId) const noexcept
+    {
+        return interfaceId == AnimationSystem::InterfaceID;
+    }
+    
+    //------------------------------------------------------------
+    u32 AnimationSystem::Add(CS::SpriteComponent* spriteComponent) noexcept
+    {
+        u32 id = 0;
+        if(m_freeIds.empty() == false)
+        {
+            id = m_freeIds.back();
+            m_freeIds.pop_back();
+        }
+        else
+        {
+            id = u32(m_instanceIndices.size());
+            m_instanceIndices.push_back(k_noInstance);
+        }
+        
+        m_instanceIndices[id] = u32(m_instances.size());
+        m_instances.push_back({spriteComponent, nullptr, 0.0f, 0, k_noFrame, PlayMode::k_looping, false, id});
+        return id;
+    }
+    
+    //------------------------------------------------------------
+    void AnimationSystem::Remove(u32 animationId) noexcept
+    {
+        CS_ASSERT(animationId < m_instanceIndices.size() && m_instanceIndices[animationId] != k_noInstance, "Invalid animation id.");
+        
+        u32 index = m_instanceIndices[animationId];
+        if(index != u32(m_instances.size()) - 1)
+        {
+            m_instances[index] = m_instances.back();
+            m_instanceIndices[m_instances[index].m_id] = index;
+        }
+        
+        m_instances.pop_back();
+        m_instanceIndices[animationId] = k_noInstance;
+        m_freeIds.push_back(animationId);
+    }
+    
+    //------------------------------------------------------------
+    void AnimationSystem::Play(u32 animationId, const AnimationClip* clip, PlayMode playMode) noexcept
+    {
+        CS_ASSERT(animationId < m_instanceIndices.size() && m_instanceIndices[animationId] != k_noInstance, "Invalid animation id.");
+        
+        auto& instance = m_instances[m_instanceIndices[animationId]];
+        instance.m_playMode = playMode;
+        if(clip != instance.m_clip)
+        {
+            //Frame indices are local to a clip so the one applied can't be compared against the new clip's
+            instance.m_clip = clip;
+            instance.m_appliedFrame = k_noFrame;
+            Restart(instance);
+        }
+    }
+    
+    //------------------------------------------------------------
+    void AnimationSystem::Restart(u32 animationId) noexcept
+    {
+        CS_ASSERT(animationId < m_instanceIndices.size() && m_instanceIndices[animationId] != k_noInstance, "Invalid animation id.");
+        
+        Restart(m_instances[m_instanceIndices[animationId]]);
+    }
+    
+    //------------------------------------------------------------
+    bool AnimationSystem::IsFinished(u32 animationId) const noexcept
+    {
+        CS_ASSERT(animationId < m_instanceIndices.size() && m_instanceIndices[animationId] != k_noInstance, "Invalid animation id.");
+        
+        return m_instances[m_instanceIndices[animationId]].m_finished;
+    }
+    
+    //------------------------------------------------------------
+    void AnimationSystem::OnUpdate(f32 timeSinceLastUpdate) noexcept
+    {
+#ifdef CSRUNNER_ANIMATION_STATS
+        auto startTime = std::chrono::steady_clock::now();
+        u32 frameChanges = 0;
+#endif
+        
+        for(auto& instance : m_instances)
+        {
+            if(instance.m_clip == nullptr || instance.m_finished == true)
+            {
+                continue;
+            }
+            
+            instance.m_timeSinceLastFrame += timeSinceLastUpdate;
+            
+            // If the update FPS is less than the desired animation FPS we skip frames to keep the
+            // animation a fixed length
+            f32 frameTime = instance.m_clip->GetFrameTime();
+            u32 numFramesElapsed = (u32)(instance.m_timeSinceLastFrame/frameTime);
+            if(numFramesElapsed == 0)
+            {
+                continue;
+            }
+            
+            u32 numKeyframes = instance.m_clip->GetNumKeyframes();
+            instance.m_timeSinceLastFrame -= numFramesElapsed * frameTime;
+            instance.m_currentKeyframe += numFramesElapsed;
+            if(instance.m_currentKeyframe >= numKeyframes)
+            {
+                switch(instance.m_playMode)
+                {
+                    case PlayMode::k_once:
+                        instance.m_currentKeyframe = numKeyframes - 1;
+                        instance.m_finished = true;
+                        break;
+                    case PlayMode::k_looping:
+                        instance.m_currentKeyframe = instance.m_currentKeyframe % numKeyframes;
+                        break;
+                }
+            }
+            
+#ifdef CSRUNNER_ANIMATION_STATS
+            if(ApplyFrame(instance) == true)
+            {
+                ++frameChanges;
+            }
+#else
+            ApplyFrame(instance);
+#endif
+        }
+        
+#ifdef CSRUNNER_ANIMATION_STATS
+        m_statsUpdateTime += std::chrono::duration<f64, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+        m_statsFrameChanges += frameChanges;
+        m_statsNumFrames++;
+        m_statsTimer += timeSinceLastUpdate;
+        if(m_statsTimer >= k_statsInterval)
+        {
+            CS_LOG_VERBOSE("Animation pass: " + CS::ToString(u32(m_instances.size())) + " instances, " + CS::ToString(f32(m_statsUpdateTime / m_statsNumFrames)) + "us per frame, " +
+                           CS::ToString(f32(m_statsFrameChanges) / f32(m_statsNumFrames)) + " sprite frame changes per frame");
+            
+            m_statsFrameChanges = 0;
+            m_statsNumFrames = 0;
+            m_statsUpdateTime = 0.0;
+            m_statsTimer = 0.0f;
+        }
+#endif
+    }
+    
+    //------------------------------------------------------------
+    void AnimationSystem::Restart(Instance& instance) noexcept
+    {
+        instance.m_currentKeyframe = 0;
+        instance.m_timeSinceLastFrame = 0.0f;
+        instance.m_finished = false;
+        
+        if(instance.m_clip != nullptr)
+        {
+            ApplyFrame(instance);
+        }
+    }
+    
+    //------------------------------------------------------------
+    bool AnimationSystem::ApplyFrame(Instance& instance) noexcept
+    {
+        u32 frame = instance.m_clip->GetFrame(instance.m_currentKeyframe);
+        if(frame == instance.m_appliedFrame)
+        {
+            return false;
+        }
+        
+        instance.m_spriteComponent->SetTextureAtlasId(instance.m_clip->GetFrameAtlasId(frame));
+        instance.m_appliedFrame = frame;
+        return true;
+    }
+}
@@ -0,0 +1,152 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ANIMATION_ANIMATIONSYSTEM_H_
+#define _APPSOURCE_ANIMATION_ANIMATIONSYSTEM_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/System.h>
+
+#include <vector>
+
+namespace CSRunner
+{
+    /// Owns every sprite animation in the state and advances them all in a single pass per frame.
+    /// Instances are packed into one contiguous array and removal swaps the last instance into
+    /// the gap, so the pass never skips holes. A sprite is only told to change frame when the
+    /// frame it shows actually differs from the one last applied.
+    ///
+    /// Instances are referred to by id, which stays valid until the instance is removed.
+    ///
+    /// When CSRUNNER_ANIMATION_STATS is defined the pass is timed and its cost and number of
+    /// sprite frame changes are logged every few seconds.
+    ///
+    class AnimationSystem final : public CS::StateSystem
+    {
+    public:
+        
+        CS_DECLARE_NAMEDTYPE(AnimationSystem);
+        
+        enum class PlayMode
+        {
+            k_once,
+            k_looping
+        };
+        
+        ///
+        static AnimationSystemUPtr Create() noexcept;
+        
+        ///
+        bool IsA(CS::InterfaceIDType interfaceId) const noexcept override;
+        
+        /// Adds an animation instance for the given sprite. Nothing plays until a clip is set.
+        ///
+        /// @param spriteComponent
+        ///     The sprite to animate. Must outlive the instance.
+        ///
+        /// @return Id of the new instance
+        ///
+        u32 Add(CS::SpriteComponent* spriteComponent) noexcept;
+        
+        /// @param animationId
+        ///     Instance to remove
+        ///
+        void Remove(u32 animationId) noexcept;
+        
+        /// Plays a clip from its first frame. If the clip is already playing only the mode changes.
+        ///
+        /// @param animationId
+        ///     Instance to play on
+        /// @param clip
+        ///     The clip to play. Must outlive its use by the instance.
+        /// @param playMode
+        ///     Whether to continuously loop or stop once the end is reached
+        ///
+        void Play(u32 animationId, const AnimationClip* clip, PlayMode playMode) noexcept;
+        
+        /// Restarts the current clip from its first frame
+        ///
+        /// @param animationId
+        ///     Instance to restart
+        ///
+        void Restart(u32 animationId) noexcept;
+        
+        /// @param animationId
+        ///     Instance to query
+        ///
+        /// @return TRUE if the instance is playing once and has reached its last frame
+        ///
+        bool IsFinished(u32 animationId) const noexcept;
+        
+    private:
+        
+        /// Playback state of a single sprite
+        ///
+        struct Instance final
+        {
+            CS::SpriteComponent* m_spriteComponent;
+            const AnimationClip* m_clip;
+            f32 m_timeSinceLastFrame;
+            u32 m_currentKeyframe;
+            u32 m_appliedFrame;
+            PlayMode m_playMode;
+            bool m_finished;
+            u32 m_id;
+        };
+        
+        ///
+        AnimationSystem() = default;
+        
+        /// Advances every instance
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since last update
+        ///
+        void OnUpdate(f32 timeSinceLastUpdate) noexcept override;
+        
+        /// Resets an instance to the first keyframe of its clip and applies it
+        ///
+        void Restart(Instance& instance) noexcept;
+        
+        /// Tells the sprite to show the current keyframe if it isn't already
+        ///
+        /// @return Whether the sprite was changed
+        ///
+        bool ApplyFrame(Instance& instance) noexcept;
+        
+        std::vector<Instance> m_instances;
+        std::vector<u32> m_instanceIndices;
+        std::vector<u32> m_freeIds;
+        
+#ifdef CSRUNNER_ANIMATION_STATS
+        u32 m_statsFrameChanges = 0;
+        u32 m_statsNumFrames = 0;
+        f64 m_statsUpdateTime = 0.0;
+        f32 m_statsTimer = 0.0f;
+#endif
+    };
+}
+
+#endif
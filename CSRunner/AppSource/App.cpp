@@ -24,7 +24,12 @@
 
 #include <App.h>
 
+#include <Animation/AnimationClipTableProvider.h>
+#include <Environment/ObstaclePatternLibraryProvider.h>
+#include <Simulation/TweenBenchmark.h>
+#include <States/SimulationState.h>
 #include <States/SplashState.h>
+#include <States/SweepState.h>
 
 #include <ChilliSource/Audio/CricketAudio.h>
 
@@ -55,6 +60,9 @@ namespace CSRunner
     //------------------------------------------------------------
     void App::CreateSystems() noexcept
     {
+        CreateSystem<AnimationClipTableProvider>();
+        CreateSystem<ObstaclePatternLibraryProvider>();
+        
 #ifndef CS_TARGETPLATFORM_RPI
         //If you have purchased a source code license from Cricket Technology, this product is covered by the source code license (http://www.crickettechnology.com/source_license).
         //Otherwise, this product is covered by the free license (http://www.crickettechnology.com/free_license).
@@ -67,7 +75,18 @@ namespace CSRunner
     void App::PushInitialState() noexcept
     {
         CS_LOG_VERBOSE("Thanks to CodeManu for the game music. https://opengameart.org/content/platformer-game-music-pack");
+#ifdef CSRUNNER_TWEEN_BENCHMARK
+        TweenBenchmark::Run();
+#endif
+#if defined(CSRUNNER_HEADLESS_SIMULATION)
+        //The simulation build skips the front end and runs the auto player headless as fast as possible
+        GetStateManager()->Push(std::make_shared<SimulationState>(1, 0));
+#elif defined(CSRUNNER_DIFFICULTY_SWEEP)
+        //The sweep build plays thousands of auto player runs across every core for each difficulty configuration
+        GetStateManager()->Push(std::make_shared<SweepState>());
+#else
         GetStateManager()->Push(std::make_shared<SplashState>());
+#endif
     }
 }
 
@@ -55,20 +55,27 @@ namespace CSRunner
     //------------------------------------------------------------
     void CollisionSystem::OnUpdate(f32 timeSinceLastUpdate) noexcept
     {
+        if(m_manualStepping == false)
+        {
+            Step(timeSinceLastUpdate);
+        }
+    }
+    
+    //------------------------------------------------------------
+    void CollisionSystem::Step(f32 timeSinceLastUpdate) noexcept
+    {
+        //The stream sweeps the box back to where the player was last step
+        const auto& stream = m_levelGenerator->GetStream();
         CS::Rectangle playerBox = m_playerController->GetWorldCollisionBox();
+        auto obstacle = stream.FindFirstHit(playerBox, m_hasPreviousPlayerBox == true ? &m_previousPlayerBox : nullptr);
+        
+        m_previousPlayerBox = playerBox;
+        m_hasPreviousPlayerBox = true;
         
         //Player only collides with one obstacle at a time to prevent them being doubly punished
-        u32 index = 0;
-        std::vector<CS::Rectangle> obstacleBoxes = m_levelGenerator->GetObstacleCollisionBoxes();
-        for(const auto& obBox : obstacleBoxes)
+        if(obstacle != nullptr)
         {
-            if(CS::ShapeIntersection::Intersects(playerBox, obBox) == true)
-            {
-                m_onPlayerObstacleCollision.NotifyConnections(index);
-                break;
-            }
-            
-            ++index;
+            m_onPlayerObstacleCollision.NotifyConnections(stream.GetObstacles().GetHandle(*obstacle));
         }
     }
 }
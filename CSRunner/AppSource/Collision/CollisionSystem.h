@@ -28,6 +28,7 @@
 #include <ForwardDeclarations.h>
 
 #include <ChilliSource/Core/Event.h>
+#include <ChilliSource/Core/Math.h>
 #include <ChilliSource/Core/System.h>
 
 #include <functional>
@@ -55,18 +56,32 @@ namespace CSRunner
         /// @param playerController
         ///     The player component used to check against obstacles
         ///
-        void SetPlayer(const PlayerController* playerController) noexcept { m_playerController = playerController; }
+        void SetPlayer(const PlayerController* playerController) noexcept { m_playerController = playerController; m_hasPreviousPlayerBox = false; }
         
         /// @return Event that is called when the player collides with an obstacle
         ///
-        CS::IConnectableEvent<std::function<void(u32)>>& GetPlayerObstacleCollisionEvent() noexcept { return m_onPlayerObstacleCollision; };
+        CS::IConnectableEvent<std::function<void(const ObstacleHandle&)>>& GetPlayerObstacleCollisionEvent() noexcept { return m_onPlayerObstacleCollision; };
+        
+        /// @param manualStepping
+        ///     Whether the system is only advanced by calls to Step() rather than every frame
+        ///
+        void SetManualStepping(bool manualStepping) noexcept { m_manualStepping = manualStepping; }
+        
+        /// Check for collisions and tell the player to perform any responses. The player is swept
+        /// along the scroll axis from its position last step, so obstacles are hit however far they
+        /// moved this step.
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since the last step
+        ///
+        void Step(f32 timeSinceLastUpdate) noexcept;
         
     private:
         
         ///
         CollisionSystem(const LevelGeneratorSystem* levelGenerator) noexcept;
         
-        /// Check for collisions and tell the player to perform any responses
+        /// Steps the system unless it is manually stepped
         ///
         /// @param timeSinceLastUpdate
         ///     Time in seconds since last update
@@ -78,7 +93,11 @@ namespace CSRunner
         const PlayerController* m_playerController = nullptr;
         const LevelGeneratorSystem* m_levelGenerator;
         
-        CS::Event<std::function<void(u32)>> m_onPlayerObstacleCollision;
+        CS::Rectangle m_previousPlayerBox;
+        bool m_hasPreviousPlayerBox = false;
+        bool m_manualStepping = false;
+        
+        CS::Event<std::function<void(const ObstacleHandle&)>> m_onPlayerObstacleCollision;
     };
 }
 
@@ -0,0 +1,100 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_ARRAYVIEW_H_
+#define _APPSOURCE_COMMON_ARRAYVIEW_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <vector>
+
+namespace CSRunner
+{
+    /// Non-owning, read-only view over a contiguous array of elements. Allows systems to
+    /// read another system's storage in place without copying it. The view is invalidated
+    /// by anything that reallocates the underlying storage, so it should be fetched fresh
+    /// each time it is used rather than stored.
+    ///
+    template <typename TType> class ArrayView final
+    {
+    public:
+        
+        using const_iterator = const TType*;
+        
+        ///
+        ArrayView() = default;
+        
+        /// @param data
+        ///     Pointer to the first element
+        /// @param size
+        ///     Number of elements
+        ///
+        ArrayView(const TType* data, std::size_t size) noexcept
+        : m_data(data), m_size(size)
+        {
+        }
+        
+        /// @param vector
+        ///     Vector to view. Must outlive the view and must not reallocate while viewed.
+        ///
+        ArrayView(const std::vector<TType>& vector) noexcept
+        : m_data(vector.data()), m_size(vector.size())
+        {
+        }
+        
+        /// @return Number of elements
+        ///
+        std::size_t size() const noexcept { return m_size; }
+        
+        /// @return TRUE if there are no elements
+        ///
+        bool empty() const noexcept { return m_size == 0; }
+        
+        ///
+        const_iterator begin() const noexcept { return m_data; }
+        
+        ///
+        const_iterator end() const noexcept { return m_data + m_size; }
+        
+        /// @param index
+        ///     Index of the element. Must be less than size()
+        ///
+        /// @return The element at the given index
+        ///
+        const TType& operator[](std::size_t index) const noexcept
+        {
+            CS_ASSERT(index < m_size, "ArrayView index out of bounds.");
+            return m_data[index];
+        }
+        
+    private:
+        
+        const TType* m_data = nullptr;
+        std::size_t m_size = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,146 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_BINARYDATA_H_
+#define _APPSOURCE_COMMON_BINARYDATA_H_
+
+#include <ForwardDeclarations.h>
+
+#include <cstring>
+#include <string>
+
+namespace CSRunner
+{
+    /// Helpers for validating and reading the binary resources built by the content pipeline.
+    /// Every file is read into one buffer and is little endian and 4 byte aligned throughout.
+    /// Offsets and counts come from the file, so every check is written so that it cannot wrap
+    /// whatever values a corrupt file holds.
+    ///
+    namespace BinaryData
+    {
+        /// @param data
+        ///     File data
+        /// @param offset
+        ///     Byte offset of the value, which must lie within the data
+        ///
+        /// @return The value at the offset
+        ///
+        template <typename TType> TType Read(const u8* data, u32 offset) noexcept
+        {
+            TType value;
+            memcpy(&value, data + offset, sizeof(TType));
+            return value;
+        }
+        
+        /// @param offset
+        ///     Start of the range
+        /// @param size
+        ///     Length of the range
+        /// @param limit
+        ///     Length of the space the range must lie in
+        ///
+        /// @return Whether [offset, offset + size) lies within [0, limit)
+        ///
+        inline bool IsRangeInBounds(u32 offset, u32 size, u32 limit) noexcept
+        {
+            return offset <= limit && size <= limit - offset;
+        }
+        
+        /// Reads a string stored as an offset and length into the string section
+        ///
+        /// @param data
+        ///     File data
+        /// @param dataSize
+        ///     Size of the file data
+        /// @param stringsOffset
+        ///     Offset of the string section, which runs to the end of the data
+        /// @param entryOffset
+        ///     Offset of the string's offset and length, which must lie within the data
+        /// @param out_string
+        ///     The string
+        ///
+        /// @return FALSE if the string runs outside the string section
+        ///
+        inline bool TryReadString(const u8* data, u32 dataSize, u32 stringsOffset, u32 entryOffset, std::string& out_string) noexcept
+        {
+            u32 stringOffset = Read<u32>(data, entryOffset);
+            u32 stringLength = Read<u32>(data, entryOffset + 4);
+            if(stringsOffset > dataSize || IsRangeInBounds(stringOffset, stringLength, dataSize - stringsOffset) == false)
+            {
+                return false;
+            }
+            
+            out_string.assign(reinterpret_cast<const char*>(data + stringsOffset + stringOffset), stringLength);
+            return true;
+        }
+        
+        /// Places the sections that follow a file header, each an array of fixed size elements
+        /// counted in the header, one after another. The running end is kept in 64 bits so
+        /// that no count can wrap it; once Fits() holds every offset returned fits in 32 bits.
+        ///
+        class SectionLayout final
+        {
+        public:
+            
+            /// @param headerSize
+            ///     Size of the header the first section follows
+            ///
+            SectionLayout(u32 headerSize) noexcept
+            : m_end(headerSize)
+            {
+            }
+            
+            /// @param count
+            ///     Number of elements in the section
+            /// @param elementSize
+            ///     Size of each element
+            ///
+            /// @return Offset of the section. Only meaningful once Fits() has been checked.
+            ///
+            u32 AddSection(u32 count, u32 elementSize) noexcept
+            {
+                u64 offset = m_end;
+                m_end += u64(count) * u64(elementSize);
+                return u32(offset);
+            }
+            
+            /// @param dataSize
+            ///     Size of the file data
+            ///
+            /// @return Whether every section added so far lies within the data
+            ///
+            bool Fits(u32 dataSize) const noexcept { return m_end <= dataSize; }
+            
+            /// @return Offset just past the last section. Only meaningful once Fits() has been checked.
+            ///
+            u32 GetEnd() const noexcept { return u32(m_end); }
+            
+        private:
+            
+            u64 m_end;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,131 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_BINARYRESOURCEPROVIDER_H_
+#define _APPSOURCE_COMMON_BINARYRESOURCEPROVIDER_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <memory>
+#include <string>
+
+namespace CSRunner
+{
+    /// Shared loading for the binary resources built by the content pipeline. The whole file is
+    /// read into one buffer which is handed to the resource's Build(), so the resource can keep
+    /// the buffer and view its contents in place.
+    ///
+    /// Each provider derives from this, adding only its named type and file extension.
+    ///
+    /// @param TResource
+    ///     Resource type, which must provide Build(std::unique_ptr<const u8[]>, u32)
+    ///
+    template <typename TResource> class BinaryResourceProvider : public CS::ResourceProvider
+    {
+    public:
+        
+        ///
+        CS::InterfaceIDType GetResourceType() const noexcept final
+        {
+            return TResource::InterfaceID;
+        }
+        
+        ///
+        bool CanCreateResourceWithFileExtension(const std::string& extension) const noexcept final
+        {
+            return extension == m_fileExtension;
+        }
+        
+        ///
+        void CreateResourceFromFile(CS::StorageLocation location, const std::string& filePath, const CS::IResourceOptionsBaseCSPtr& options, const CS::ResourceSPtr& out_resource) noexcept final
+        {
+            Load(location, filePath, out_resource);
+        }
+        
+        ///
+        void CreateResourceFromFileAsync(CS::StorageLocation location, const std::string& filePath, const CS::IResourceOptionsBaseCSPtr& options, const AsyncLoadDelegate& delegate, const CS::ResourceSPtr& out_resource) noexcept final
+        {
+            auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+            taskScheduler->ScheduleTask(CS::TaskType::k_file, [=](const CS::TaskContext&) noexcept
+            {
+                Load(location, filePath, out_resource);
+                
+                CS::Application::Get()->GetTaskScheduler()->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext&) noexcept
+                {
+                    delegate(out_resource);
+                });
+            });
+        }
+        
+    protected:
+        
+        /// @param fileExtension
+        ///     Extension of the files this provider loads
+        ///
+        BinaryResourceProvider(const std::string& fileExtension) noexcept
+        : m_fileExtension(fileExtension)
+        {
+        }
+        
+    private:
+        
+        /// Reads the whole file into one buffer and builds the resource directly from it
+        ///
+        /// @param location
+        ///     Storage location of the file
+        /// @param filePath
+        ///     Path of the file
+        /// @param out_resource
+        ///     Resource to build
+        ///
+        void Load(CS::StorageLocation location, const std::string& filePath, const CS::ResourceSPtr& out_resource) const noexcept
+        {
+            auto resource = std::static_pointer_cast<TResource>(out_resource);
+            
+            auto stream = CS::Application::Get()->GetFileSystem()->CreateBinaryInputStream(location, filePath);
+            if(stream == nullptr)
+            {
+                CS_LOG_ERROR("Could not open '" + filePath + "'.");
+                resource->SetLoadState(CS::Resource::LoadState::k_failed);
+                return;
+            }
+            
+            u32 dataSize = u32(stream->GetLength());
+            std::unique_ptr<u8[]> data(new u8[dataSize]);
+            stream->Read(data.get(), dataSize);
+            
+            bool built = resource->Build(std::unique_ptr<const u8[]>(data.release()), dataSize);
+            resource->SetLoadState(built == true ? CS::Resource::LoadState::k_loaded : CS::Resource::LoadState::k_failed);
+        }
+        
+        std::string m_fileExtension;
+    };
+}
+
+#endif
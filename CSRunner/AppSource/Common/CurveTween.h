@@ -0,0 +1,116 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_CURVETWEEN_H_
+#define _APPSOURCE_COMMON_CURVETWEEN_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Tween.h>
+
+#include <Common/EasingCurve.h>
+
+#include <algorithm>
+
+namespace CSRunner
+{
+    /// Tween between two values along a shared EasingCurve. Stands in for the engine's eased
+    /// tweens where many are updated every frame: it holds no curve of its own and evaluates
+    /// the curve's lookup table rather than the easing function.
+    ///
+    /// Supports playing once, or ping-ponging to the end value and back, with the duration
+    /// applying to each direction.
+    ///
+    template <typename TValue> class CurveTween final
+    {
+    public:
+        
+        ///
+        CurveTween() = default;
+        
+        /// @param curve
+        ///     Shared easing curve. Must outlive the tween.
+        /// @param from
+        ///     Value at the start
+        /// @param to
+        ///     Value at the end
+        /// @param duration
+        ///     Seconds from start to end
+        /// @param playMode
+        ///     Once or ping-pong
+        ///
+        CurveTween(const EasingCurve* curve, const TValue& from, const TValue& to, f32 duration, CS::TweenPlayMode playMode) noexcept
+        : m_curve(curve), m_from(from), m_delta(to - from), m_duration(duration), m_playMode(playMode)
+        {
+            CS_ASSERT(m_curve != nullptr && m_duration > 0.0f, "Curve tween requires a curve and a positive duration.");
+            CS_ASSERT(m_playMode == CS::TweenPlayMode::k_once || m_playMode == CS::TweenPlayMode::k_pingPong, "Curve tween only plays once or ping-pong.");
+        }
+        
+        /// Advances the tween
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds
+        ///
+        /// @return Value at the new time
+        ///
+        TValue Update(f32 timeSinceLastUpdate) noexcept
+        {
+            m_time = std::min(m_time + timeSinceLastUpdate, GetTotalDuration());
+            
+            f32 t = m_time / m_duration;
+            if(t > 1.0f)
+            {
+                t = 2.0f - t;
+            }
+            
+            return m_from + m_delta * m_curve->Evaluate(t);
+        }
+        
+        /// @return Whether the tween has played to the end
+        ///
+        bool IsFinished() const noexcept
+        {
+            return m_time >= GetTotalDuration();
+        }
+        
+    private:
+        
+        /// @return Seconds for the whole tween, in both directions for ping-pong
+        ///
+        f32 GetTotalDuration() const noexcept
+        {
+            return m_playMode == CS::TweenPlayMode::k_pingPong ? m_duration * 2.0f : m_duration;
+        }
+        
+        const EasingCurve* m_curve = nullptr;
+        TValue m_from = TValue();
+        TValue m_delta = TValue();
+        f32 m_duration = 1.0f;
+        f32 m_time = 0.0f;
+        CS::TweenPlayMode m_playMode = CS::TweenPlayMode::k_once;
+    };
+}
+
+#endif
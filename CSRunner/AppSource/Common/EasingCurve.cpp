@@ -0,0 +1,87 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/EasingCurve.h>
+
+namespace CSRunner
+{
+    namespace Easing
+    {
+        //------------------------------------------------------------
+        f32 EaseOutBack(f32 t) noexcept
+        {
+            constexpr f32 k_overshoot = 1.70158f;
+            
+            t -= 1.0f;
+            return t * t * ((k_overshoot + 1.0f) * t + k_overshoot) + 1.0f;
+        }
+        
+        //------------------------------------------------------------
+        f32 EaseInOutQuad(f32 t) noexcept
+        {
+            if(t < 0.5f)
+            {
+                return 2.0f * t * t;
+            }
+            
+            return -1.0f + (4.0f - 2.0f * t) * t;
+        }
+        
+        //------------------------------------------------------------
+        f32 SmoothStep(f32 t) noexcept
+        {
+            return t * t * (3.0f - 2.0f * t);
+        }
+    }
+    
+    //------------------------------------------------------------
+    const EasingCurve& EasingCurve::GetEaseOutBack() noexcept
+    {
+        static const EasingCurve curve(&Easing::EaseOutBack);
+        return curve;
+    }
+    
+    //------------------------------------------------------------
+    const EasingCurve& EasingCurve::GetEaseInOutQuad() noexcept
+    {
+        static const EasingCurve curve(&Easing::EaseInOutQuad);
+        return curve;
+    }
+    
+    //------------------------------------------------------------
+    const EasingCurve& EasingCurve::GetSmoothStep() noexcept
+    {
+        static const EasingCurve curve(&Easing::SmoothStep);
+        return curve;
+    }
+    
+    //------------------------------------------------------------
+    EasingCurve::EasingCurve(f32 (*function)(f32)) noexcept
+    {
+        for(u32 i = 0; i < k_numSamples; ++i)
+        {
+            m_samples[i] = function(f32(i) / f32(k_numSamples - 1));
+        }
+    }
+}
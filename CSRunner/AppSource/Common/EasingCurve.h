@@ -0,0 +1,115 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_EASINGCURVE_H_
+#define _APPSOURCE_COMMON_EASINGCURVE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <array>
+
+namespace CSRunner
+{
+    /// The analytic easing functions the curves are sampled from. Each maps normalised time in
+    /// [0, 1] to normalised progress, and matches the engine's tween of the same name.
+    ///
+    namespace Easing
+    {
+        /// @param t
+        ///     Normalised time
+        ///
+        /// @return Progress, overshooting past 1 before settling
+        ///
+        f32 EaseOutBack(f32 t) noexcept;
+        
+        /// @param t
+        ///     Normalised time
+        ///
+        /// @return Progress, accelerating then decelerating
+        ///
+        f32 EaseInOutQuad(f32 t) noexcept;
+        
+        /// @param t
+        ///     Normalised time
+        ///
+        /// @return Progress, easing in and out with a smooth step
+        ///
+        f32 SmoothStep(f32 t) noexcept;
+    }
+    
+    /// An easing function sampled into a small lookup table and evaluated by linear
+    /// interpolation, so a tween update costs a multiply, a table read and a lerp rather than
+    /// the easing polynomial.
+    ///
+    /// The shared curves are built on first use and are read only from then on, so they can be
+    /// used by any number of tweens on any thread.
+    ///
+    class EasingCurve final
+    {
+    public:
+        
+        static constexpr u32 k_numSamples = 128;
+        
+        /// @return Shared table for Easing::EaseOutBack
+        ///
+        static const EasingCurve& GetEaseOutBack() noexcept;
+        
+        /// @return Shared table for Easing::EaseInOutQuad
+        ///
+        static const EasingCurve& GetEaseInOutQuad() noexcept;
+        
+        /// @return Shared table for Easing::SmoothStep
+        ///
+        static const EasingCurve& GetSmoothStep() noexcept;
+        
+        /// @param function
+        ///     Easing function to sample across [0, 1]
+        ///
+        EasingCurve(f32 (*function)(f32)) noexcept;
+        
+        /// @param t
+        ///     Normalised time. Clamped to [0, 1].
+        ///
+        /// @return Interpolated progress
+        ///
+        f32 Evaluate(f32 t) const noexcept
+        {
+            f32 position = (t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t)) * f32(k_numSamples - 1);
+            u32 index = u32(position);
+            if(index >= k_numSamples - 1)
+            {
+                return m_samples[k_numSamples - 1];
+            }
+            
+            f32 fraction = position - f32(index);
+            return m_samples[index] + (m_samples[index + 1] - m_samples[index]) * fraction;
+        }
+        
+    private:
+        
+        std::array<f32, k_numSamples> m_samples;
+    };
+}
+
+#endif
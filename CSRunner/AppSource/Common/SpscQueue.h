@@ -0,0 +1,118 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_SPSCQUEUE_H_
+#define _APPSOURCE_COMMON_SPSCQUEUE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <array>
+#include <atomic>
+
+namespace CSRunner
+{
+    /// Fixed capacity, lock-free queue for exactly one producer thread and one consumer
+    /// thread. Head and tail are free running counters; only the producer writes the tail
+    /// and only the consumer writes the head, so neither side ever waits on the other.
+    ///
+    template <typename TType, u32 TCapacity> class SpscQueue final
+    {
+        static_assert(TCapacity > 0 && (TCapacity & (TCapacity - 1)) == 0, "SpscQueue capacity must be a power of two.");
+        
+    public:
+        
+        ///
+        SpscQueue() = default;
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+        
+        /// Producer only.
+        ///
+        /// @return TRUE if there is no room to push
+        ///
+        bool IsFull() const noexcept
+        {
+            return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_acquire) == TCapacity;
+        }
+        
+        /// Safe to call from either thread, though the result may be stale by the time it is used.
+        ///
+        /// @return Number of items queued
+        ///
+        u32 GetSize() const noexcept
+        {
+            return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+        }
+        
+        /// Producer only.
+        ///
+        /// @param item
+        ///     Item to copy onto the back of the queue
+        ///
+        /// @return FALSE if the queue was full and nothing was pushed
+        ///
+        bool TryPush(const TType& item) noexcept
+        {
+            u32 tail = m_tail.load(std::memory_order_relaxed);
+            if(tail - m_head.load(std::memory_order_acquire) == TCapacity)
+            {
+                return false;
+            }
+            
+            m_items[tail & (TCapacity - 1)] = item;
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+        
+        /// Consumer only.
+        ///
+        /// @param out_item
+        ///     Receives the front item if there is one
+        ///
+        /// @return FALSE if the queue was empty
+        ///
+        bool TryPop(TType& out_item) noexcept
+        {
+            u32 head = m_head.load(std::memory_order_relaxed);
+            if(head == m_tail.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            
+            out_item = m_items[head & (TCapacity - 1)];
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+        
+    private:
+        
+        std::array<TType, TCapacity> m_items;
+        std::atomic<u32> m_head{0};
+        std::atomic<u32> m_tail{0};
+    };
+}
+
+#endif
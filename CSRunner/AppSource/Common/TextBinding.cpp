@@ -0,0 +1,79 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/TextBinding.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/UI/Text.h>
+
+namespace CSRunner
+{
+    namespace
+    {
+        constexpr u32 k_maxDigits = 10;
+    }
+    
+    //------------------------------------------------------------
+    TextBinding::TextBinding(CS::TextUIComponent* label, const std::string& prefix, const std::string& suffix) noexcept
+    : m_label(label), m_prefix(prefix), m_suffix(suffix)
+    {
+        CS_ASSERT(m_label != nullptr, "Text binding requires a label.");
+        
+        m_buffer.reserve(m_prefix.size() + k_maxDigits + m_suffix.size());
+    }
+    
+    //------------------------------------------------------------
+    void TextBinding::SetValue(u32 value) noexcept
+    {
+        CS_ASSERT(m_label != nullptr, "Cannot set the value of an unbound text binding.");
+        
+        if(m_hasValue == true && m_value == value)
+        {
+            return;
+        }
+        
+        m_value = value;
+        m_hasValue = true;
+        
+        Format(value);
+        m_label->SetText(m_buffer);
+    }
+    
+    //------------------------------------------------------------
+    void TextBinding::Format(u32 value) noexcept
+    {
+        char digits[k_maxDigits];
+        u32 start = k_maxDigits;
+        do
+        {
+            digits[--start] = char('0' + value % 10);
+            value /= 10;
+        }
+        while(value > 0);
+        
+        m_buffer.assign(m_prefix);
+        m_buffer.append(digits + start, k_maxDigits - start);
+        m_buffer.append(m_suffix);
+    }
+}
@@ -0,0 +1,82 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_TEXTBINDING_H_
+#define _APPSOURCE_COMMON_TEXTBINDING_H_
+
+#include <ForwardDeclarations.h>
+
+#include <string>
+
+namespace CSRunner
+{
+    /// Binds a number to a text label, displayed between a fixed prefix and suffix. The last
+    /// displayed value is cached and the text is formatted into a buffer that is reused between
+    /// updates, so setting an unchanged value costs a comparison and a change only relays the
+    /// label when the displayed text differs.
+    ///
+    class TextBinding final
+    {
+    public:
+        
+        /// Creates a binding to nothing. Must be assigned a bound one before a value is set.
+        ///
+        TextBinding() = default;
+        
+        /// @param label
+        ///     Label to display the value in. Must outlive the binding.
+        /// @param prefix
+        ///     Text shown before the value
+        /// @param suffix
+        ///     Text shown after the value
+        ///
+        TextBinding(CS::TextUIComponent* label, const std::string& prefix, const std::string& suffix) noexcept;
+        
+        /// Displays the value, unless it is already being displayed
+        ///
+        /// @param value
+        ///     Value to display
+        ///
+        void SetValue(u32 value) noexcept;
+        
+    private:
+        
+        /// Formats the prefix, value and suffix into the buffer without allocating once the
+        /// buffer has grown to fit
+        ///
+        /// @param value
+        ///     Value to format
+        ///
+        void Format(u32 value) noexcept;
+        
+        CS::TextUIComponent* m_label = nullptr;
+        std::string m_prefix;
+        std::string m_suffix;
+        std::string m_buffer;
+        u32 m_value = 0;
+        bool m_hasValue = false;
+    };
+}
+
+#endif
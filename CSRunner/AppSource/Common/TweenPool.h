@@ -0,0 +1,266 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_TWEENPOOL_H_
+#define _APPSOURCE_COMMON_TWEENPOOL_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Tween.h>
+
+#include <Common/EasingCurve.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace CSRunner
+{
+    /// Reference to a tween in a TweenPool. The generation is bumped whenever a slot is reused, so
+    /// a handle to a stopped tween never resolves to the tween that replaced it. A default
+    /// constructed handle refers to nothing.
+    ///
+    template <typename TValue> struct TweenHandle final
+    {
+        u32 m_index = 0;
+        u32 m_generation = 0;
+    };
+    
+    /// Contiguous storage for every tween of one value type. The per-frame data is packed together
+    /// and updated in a single pass, while the end delegates are held alongside so they are only
+    /// touched when a tween finishes. Stopped tweens return their slot to a free list for reuse.
+    ///
+    /// Tweens are eased through the shared EasingCurve tables. A finished tween keeps its final
+    /// value until it is stopped.
+    ///
+    template <typename TValue> class TweenPool final
+    {
+    public:
+        
+        using EndDelegate = std::function<void()>;
+        
+        /// Starts a new tween
+        ///
+        /// @param curve
+        ///     Shared easing curve. Must outlive the tween.
+        /// @param from
+        ///     Value at the start
+        /// @param to
+        ///     Value at the end
+        /// @param duration
+        ///     Seconds from start to end
+        /// @param playMode
+        ///     Once, once reversed or ping-pong
+        /// @param startDelay
+        ///     Seconds before the tween starts
+        /// @param endDelay
+        ///     Seconds the end value is held for, before turning back when ping-ponging
+        /// @param endDelegate
+        ///     Called once the tween finishes. May be null.
+        ///
+        /// @return Handle to the tween
+        ///
+        TweenHandle<TValue> Add(const EasingCurve* curve, const TValue& from, const TValue& to, f32 duration, CS::TweenPlayMode playMode, f32 startDelay, f32 endDelay, const EndDelegate& endDelegate) noexcept
+        {
+            CS_ASSERT(curve != nullptr, "Tween requires a curve.");
+            CS_ASSERT(playMode == CS::TweenPlayMode::k_once || playMode == CS::TweenPlayMode::k_onceReverse || playMode == CS::TweenPlayMode::k_pingPong, "Unsupported tween play mode.");
+            
+            u32 index = 0;
+            if(m_freeIndices.empty() == false)
+            {
+                index = m_freeIndices.back();
+                m_freeIndices.pop_back();
+            }
+            else
+            {
+                index = u32(m_tweens.size());
+                m_tweens.push_back(Tween());
+                m_endDelegates.push_back(nullptr);
+            }
+            
+            auto& tween = m_tweens[index];
+            tween.m_curve = curve;
+            tween.m_from = from;
+            tween.m_delta = to - from;
+            tween.m_duration = duration;
+            tween.m_startDelay = startDelay;
+            tween.m_endDelay = endDelay;
+            tween.m_time = 0.0f;
+            tween.m_playMode = playMode;
+            tween.m_inUse = true;
+            tween.m_finished = false;
+            tween.m_value = Evaluate(tween);
+            m_endDelegates[index] = endDelegate;
+            
+            TweenHandle<TValue> handle;
+            handle.m_index = index;
+            handle.m_generation = tween.m_generation;
+            return handle;
+        }
+        
+        /// Stops the tween and frees its slot. Does nothing if the handle no longer refers to a tween.
+        ///
+        /// @param handle
+        ///     Tween to stop
+        ///
+        void Remove(const TweenHandle<TValue>& handle) noexcept
+        {
+            if(IsValid(handle) == true)
+            {
+                auto& tween = m_tweens[handle.m_index];
+                tween.m_inUse = false;
+                ++tween.m_generation;
+                m_endDelegates[handle.m_index] = nullptr;
+                m_freeIndices.push_back(handle.m_index);
+            }
+        }
+        
+        /// @param handle
+        ///     Handle to check
+        ///
+        /// @return Whether the handle refers to a tween that has not been stopped
+        ///
+        bool IsValid(const TweenHandle<TValue>& handle) const noexcept
+        {
+            return handle.m_index < u32(m_tweens.size()) && m_tweens[handle.m_index].m_inUse == true && m_tweens[handle.m_index].m_generation == handle.m_generation;
+        }
+        
+        /// @param handle
+        ///     Valid handle
+        ///
+        /// @return Current value of the tween
+        ///
+        const TValue& GetValue(const TweenHandle<TValue>& handle) const noexcept
+        {
+            CS_ASSERT(IsValid(handle) == true, "Invalid tween handle.");
+            return m_tweens[handle.m_index].m_value;
+        }
+        
+        /// @param handle
+        ///     Handle to check
+        ///
+        /// @return Whether the tween has played to the end. Stopped tweens count as finished.
+        ///
+        bool IsFinished(const TweenHandle<TValue>& handle) const noexcept
+        {
+            return IsValid(handle) == false || m_tweens[handle.m_index].m_finished == true;
+        }
+        
+        /// Advances every playing tween. The end delegates of any that finish are moved out to be
+        /// called once every pool has been updated.
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds
+        /// @param out_endDelegates
+        ///     End delegates to call
+        ///
+        void Update(f32 timeSinceLastUpdate, std::vector<EndDelegate>& out_endDelegates) noexcept
+        {
+            for(u32 i = 0; i < u32(m_tweens.size()); ++i)
+            {
+                auto& tween = m_tweens[i];
+                if(tween.m_inUse == false || tween.m_finished == true)
+                {
+                    continue;
+                }
+                
+                f32 totalTime = GetTotalTime(tween);
+                tween.m_time = std::min(tween.m_time + timeSinceLastUpdate, totalTime);
+                tween.m_value = Evaluate(tween);
+                
+                if(tween.m_time >= totalTime)
+                {
+                    tween.m_finished = true;
+                    if(m_endDelegates[i] != nullptr)
+                    {
+                        out_endDelegates.push_back(std::move(m_endDelegates[i]));
+                        m_endDelegates[i] = nullptr;
+                    }
+                }
+            }
+        }
+        
+    private:
+        
+        /// The per-frame data of a single tween
+        ///
+        struct Tween final
+        {
+            const EasingCurve* m_curve = nullptr;
+            TValue m_from = TValue();
+            TValue m_delta = TValue();
+            TValue m_value = TValue();
+            f32 m_duration = 0.0f;
+            f32 m_startDelay = 0.0f;
+            f32 m_endDelay = 0.0f;
+            f32 m_time = 0.0f;
+            CS::TweenPlayMode m_playMode = CS::TweenPlayMode::k_once;
+            u32 m_generation = 1;
+            bool m_inUse = false;
+            bool m_finished = false;
+        };
+        
+        /// @param tween
+        ///     Tween to measure
+        ///
+        /// @return Seconds the tween plays for, including its delays
+        ///
+        static f32 GetTotalTime(const Tween& tween) noexcept
+        {
+            f32 numPasses = tween.m_playMode == CS::TweenPlayMode::k_pingPong ? 2.0f : 1.0f;
+            return tween.m_startDelay + tween.m_duration * numPasses + tween.m_endDelay;
+        }
+        
+        /// @param tween
+        ///     Tween to evaluate
+        ///
+        /// @return Value of the tween at its current time
+        ///
+        static TValue Evaluate(const Tween& tween) noexcept
+        {
+            f32 time = std::max(tween.m_time - tween.m_startDelay, 0.0f);
+            
+            //Ping-pong holds at the end value for the end delay before turning back
+            if(tween.m_playMode == CS::TweenPlayMode::k_pingPong && time > tween.m_duration)
+            {
+                time = std::min(std::max(tween.m_duration * 2.0f + tween.m_endDelay - time, 0.0f), tween.m_duration);
+            }
+            
+            f32 t = tween.m_duration > 0.0f ? std::min(time / tween.m_duration, 1.0f) : 1.0f;
+            if(tween.m_playMode == CS::TweenPlayMode::k_onceReverse)
+            {
+                t = 1.0f - t;
+            }
+            
+            return tween.m_from + tween.m_delta * tween.m_curve->Evaluate(t);
+        }
+        
+        std::vector<Tween> m_tweens;
+        std::vector<EndDelegate> m_endDelegates;
+        std::vector<u32> m_freeIndices;
+    };
+}
+
+#endif
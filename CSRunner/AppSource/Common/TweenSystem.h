@@ -0,0 +1,146 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_COMMON_TWEENSYSTEM_H_
+#define _APPSOURCE_COMMON_TWEENSYSTEM_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/System.h>
+
+#include <Common/TweenPool.h>
+
+#include <functional>
+#include <vector>
+
+namespace CSRunner
+{
+    /// Plays every tween in a state. Tweens are held in one contiguous pool per value type and all
+    /// of them are updated in a single pass each frame. End delegates are queued during the pass
+    /// and called once it is complete, so a delegate can safely start or stop tweens.
+    ///
+    /// Owners hold a handle and read the tween's value through the system. The system should be
+    /// created before any system that reads tweens so that the values are up to date when read.
+    ///
+    /// The player's tweens stay in PlayerMotion: they are stepped by the headless simulations off
+    /// the main thread, and in pieces within a step so that actions land at sub-frame times.
+    ///
+    class TweenSystem final : public CS::StateSystem
+    {
+    public:
+        
+        CS_DECLARE_NAMEDTYPE(TweenSystem);
+        
+        using EndDelegate = std::function<void()>;
+        
+        /// @return New instance
+        ///
+        static TweenSystemUPtr Create() noexcept;
+        
+        ///
+        bool IsA(CS::InterfaceIDType interfaceId) const noexcept override;
+        
+        /// Starts a new tween
+        ///
+        /// @param curve
+        ///     Shared easing curve
+        /// @param from
+        ///     Value at the start
+        /// @param to
+        ///     Value at the end
+        /// @param duration
+        ///     Seconds from start to end
+        /// @param playMode
+        ///     Once, once reversed or ping-pong
+        /// @param startDelay
+        ///     Seconds before the tween starts
+        /// @param endDelay
+        ///     Seconds the end value is held for, before turning back when ping-ponging
+        /// @param endDelegate
+        ///     Called once the tween finishes. May be null.
+        ///
+        /// @return Handle to the tween. Must be stopped once it is no longer needed.
+        ///
+        template <typename TValue> TweenHandle<TValue> Play(const EasingCurve& curve, const TValue& from, const TValue& to, f32 duration, CS::TweenPlayMode playMode, f32 startDelay = 0.0f, f32 endDelay = 0.0f, const EndDelegate& endDelegate = nullptr) noexcept
+        {
+            return GetPool(static_cast<const TValue*>(nullptr)).Add(&curve, from, to, duration, playMode, startDelay, endDelay, endDelegate);
+        }
+        
+        /// Stops the tween, without calling its end delegate, and resets the handle
+        ///
+        /// @param handle
+        ///     Tween to stop. Does nothing if it no longer refers to a tween.
+        ///
+        template <typename TValue> void Stop(TweenHandle<TValue>& handle) noexcept
+        {
+            GetPool(static_cast<const TValue*>(nullptr)).Remove(handle);
+            handle = TweenHandle<TValue>();
+        }
+        
+        /// @param handle
+        ///     Handle to a tween that has not been stopped
+        ///
+        /// @return Current value of the tween
+        ///
+        template <typename TValue> const TValue& GetValue(const TweenHandle<TValue>& handle) const noexcept
+        {
+            return GetPool(static_cast<const TValue*>(nullptr)).GetValue(handle);
+        }
+        
+        /// @param handle
+        ///     Handle to check
+        ///
+        /// @return Whether the tween is playing. A stopped or finished tween is not.
+        ///
+        template <typename TValue> bool IsPlaying(const TweenHandle<TValue>& handle) const noexcept
+        {
+            return GetPool(static_cast<const TValue*>(nullptr)).IsFinished(handle) == false;
+        }
+        
+    private:
+        
+        TweenSystem() = default;
+        
+        /// Updates every pool then calls the end delegates of the tweens that finished
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since last update
+        ///
+        void OnUpdate(f32 timeSinceLastUpdate) noexcept override;
+        
+        /// @return The pool for the value type, chosen by the type of the unused pointer
+        ///
+        TweenPool<f32>& GetPool(const f32*) noexcept { return m_floatTweens; }
+        const TweenPool<f32>& GetPool(const f32*) const noexcept { return m_floatTweens; }
+        TweenPool<CS::Vector2>& GetPool(const CS::Vector2*) noexcept { return m_vector2Tweens; }
+        const TweenPool<CS::Vector2>& GetPool(const CS::Vector2*) const noexcept { return m_vector2Tweens; }
+        
+        TweenPool<f32> m_floatTweens;
+        TweenPool<CS::Vector2> m_vector2Tweens;
+        std::vector<EndDelegate> m_pendingEndDelegates;
+    };
+}
+
+#endif
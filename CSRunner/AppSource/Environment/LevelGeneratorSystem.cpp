@@ -24,72 +24,43 @@
 
 #include <Environment/LevelGeneratorSystem.h>
 
+#include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Entity.h>
 #include <ChilliSource/Core/Scene.h>
 #include <ChilliSource/Core/State.h>
+#include <ChilliSource/Core/String.h>
 #include <ChilliSource/Core/Resource.h>
 #include <ChilliSource/Rendering/Base.h>
 #include <ChilliSource/Rendering/Sprite.h>
 #include <ChilliSource/Rendering/Material.h>
 #include <ChilliSource/Rendering/Texture.h>
 
+#include <Animation/AnimationClipTable.h>
+#include <Animation/AnimationSystem.h>
 #include <GameConfig.h>
 
-#include <array>
-
 namespace CSRunner
 {
     CS_DEFINE_NAMEDTYPE(LevelGeneratorSystem);
     
+#ifdef CSRUNNER_SCROLL_STATS
     namespace
     {
-        const std::array<std::string, 3> k_potentialObstacleIdsTop =
-        {{
-            "Balloons_Light",
-            "Chandelier_Light",
-            "Pinata_Light"
-        }};
-        
-        const std::array<std::string, 5> k_potentialObstacleIdsBottom =
-        {{
-            "CakeStand_Light",
-            "Champagne_Light",
-            "Chicken_Light",
-            "Flower_Light",
-            "Plates_Light"
-        }};
-        
-        /// Randomly picks an index based on the probability at each index
-        ///
-        u32 WeightedRandom(const std::vector<f32> probabilities) noexcept
-        {
-            f32 summedWeights = 0;
-            
-            for(f32 prob : probabilities)
-            {
-                summedWeights += prob;
-            }
-            
-            f32 randomWeighting = CS::Random::Generate(0.0f, summedWeights);
-            
-            for(u32 i=0; i<(u32)probabilities.size(); ++i)
-            {
-                if(randomWeighting < probabilities[i])
-                {
-                    return i;
-                }
-                
-                randomWeighting -= probabilities[i];
-            }
-            
-            return 0;
-        }
+        constexpr f32 k_statsInterval = 5.0f;
     }
+#endif
     
     //------------------------------------------------------------
-    LevelGeneratorSystemUPtr LevelGeneratorSystem::Create() noexcept
+    LevelGeneratorSystemUPtr LevelGeneratorSystem::Create(AnimationSystem* animationSystem, u32 seed, const DifficultyConfig& config, ObstacleSequencer::RefillMode refillMode) noexcept
     {
-        return LevelGeneratorSystemUPtr(new LevelGeneratorSystem());
+        return LevelGeneratorSystemUPtr(new LevelGeneratorSystem(animationSystem, seed, config, refillMode));
+    }
+    
+    //------------------------------------------------------------
+    LevelGeneratorSystem::LevelGeneratorSystem(AnimationSystem* animationSystem, u32 seed, const DifficultyConfig& config, ObstacleSequencer::RefillMode refillMode) noexcept
+    : m_animationSystem(animationSystem), m_seed(seed), m_config(config), m_refillMode(refillMode)
+    {
+        
     }
     
     //------------------------------------------------------------
@@ -108,6 +79,7 @@ namespace CSRunner
         
         auto effectsTexture = resourcePool->LoadResource<CS::Texture>(CS::StorageLocation::k_package, "TextureAtlases/Effects/Effects.csimage");
         auto effectsAtlas = resourcePool->LoadResource<CS::TextureAtlas>(CS::StorageLocation::k_package, "TextureAtlases/Effects/Effects.csatlas");
+        m_effectsClips = resourcePool->LoadResource<AnimationClipTable>(CS::StorageLocation::k_package, "TextureAtlases/Effects/Effects.csclips");
         
         auto environmentTexture = resourcePool->LoadResource<CS::Texture>(CS::StorageLocation::k_package, "TextureAtlases/Level/Level.csimage");
         auto environmentAtlas = resourcePool->LoadResource<CS::TextureAtlas>(CS::StorageLocation::k_package, "TextureAtlases/Level/Level.csatlas");
@@ -132,14 +104,23 @@ namespace CSRunner
             environmentMaterial = materialFactory->CreateUnlit("Environment", environmentTexture, true);
         }
         
+        //Obstacles are children of the world so that only one transform changes per frame for all of them
+        m_world = CS::Entity::Create();
+        GetState()->GetMainScene()->Add(m_world);
+        
+        m_catalogue = ObstacleCatalogueUPtr(new ObstacleCatalogue(obstaclesAtlas.get()));
+        auto patterns = resourcePool->LoadResource<ObstaclePatternLibrary>(CS::StorageLocation::k_package, "Patterns/Patterns.cspatterns");
+        auto sequencer = ObstacleSequencer::Create(m_seed, *m_catalogue, patterns, m_config, m_refillMode);
+        m_stream = LevelStreamUPtr(new LevelStream(m_config, *m_catalogue, sequencer));
+        CS_LOG_VERBOSE("Level seed: " + CS::ToString(m_seed));
+        
         //Sprites are aligned to the right so that we know they are fully offscreen when their origin as at the screen edge
         //Obstacles
         m_inactiveObstacles.reserve(GameConfig::k_maxObstacles);
-        m_activeObstacles.reserve(GameConfig::k_maxObstacles);
         for(u32 i=0; i<GameConfig::k_maxObstacles; ++i)
         {
             CS::EntitySPtr entity = CS::Entity::Create();
-            auto sprite = std::make_shared<CS::SpriteComponent>(obstaclesMaterial, obstaclesAtlas, k_potentialObstacleIdsBottom[0], CS::Vector2::k_one, CS::SizePolicy::k_usePreferredSize);
+            auto sprite = std::make_shared<CS::SpriteComponent>(obstaclesMaterial, obstaclesAtlas, m_catalogue->GetObstacle(ObstacleType::k_low, 0).m_atlasId, CS::Vector2::k_one, CS::SizePolicy::k_usePreferredSize);
             sprite->SetOriginAlignment(CS::AlignmentAnchor::k_middleRight);
             entity->AddComponent(sprite);
             m_inactiveObstacles.push_back(entity);
@@ -149,181 +130,132 @@ namespace CSRunner
         m_explosionEffect = CS::Entity::Create();
         auto explosionSprite = std::make_shared<CS::SpriteComponent>(effectsMaterial, effectsAtlas, "Explosion_1", CS::Vector2::k_one, CS::SizePolicy::k_usePreferredSize);
         m_explosionEffect->AddComponent(explosionSprite);
-        m_explosionAnimation = KeyframeAnimationUPtr(new KeyframeAnimation(explosionSprite.get(), {"Explosion_1","Explosion_2","Explosion_2"}, 15.0f));
+        m_explosionAnimationId = m_animationSystem->Add(explosionSprite.get());
+        m_animationSystem->Play(m_explosionAnimationId, m_effectsClips->GetClip("Explosion"), AnimationSystem::PlayMode::k_once);
         
-        //BGs
-        std::vector<std::string> bgAtlasIds = {"Background_1_Light","Background_2_Light"};
-        auto bgSize = environmentAtlas->GetOriginalFrameSize(bgAtlasIds[0]);
-        m_bgSizeX = bgSize.x;
-        u32 numBGTiles = (u32)std::ceil(GameConfig::k_levelWidth/m_bgSizeX) + 1;
-        m_bgTiles.reserve(numBGTiles);
-        f32 xPos = GameConfig::k_cullX;
-        
-        for(u32 i=0; i<numBGTiles; ++i)
-        {
-            CS::EntitySPtr entity = CS::Entity::Create();
-            auto sprite = std::make_shared<CS::SpriteComponent>(environmentMaterial, environmentAtlas, bgAtlasIds[i%bgAtlasIds.size()], CS::Vector2::k_one, CS::SizePolicy::k_usePreferredSize);
-            sprite->SetOriginAlignment(CS::AlignmentAnchor::k_middleRight);
-            entity->AddComponent(sprite);
-            GetState()->GetMainScene()->Add(entity);
-            entity->GetTransform().SetPosition(xPos, 0.0f, 2.0f);
-            m_bgTiles.push_back(entity);
-            xPos += m_bgSizeX;
-        }
+        //Each repeating layer is one pre-built strip, scrolled by offsetting its entity
+        //BG
+        m_bgStrip = TiledStripUPtr(new TiledStrip("BackgroundStrip", environmentMaterial, environmentAtlas, {"Background_1_Light","Background_2_Light"}, GameConfig::k_levelWidth + environmentAtlas->GetOriginalFrameSize("Background_1_Light").x));
+        m_bgStrip->SetRestPosition(CS::Vector3(GameConfig::k_cullX - environmentAtlas->GetOriginalFrameSize("Background_1_Light").x, 0.0f, 2.0f));
+        GetState()->GetMainScene()->Add(m_bgStrip->GetEntity());
         
         //FGs
-        m_fgSizeX = environmentAtlas->GetOriginalFrameSize("Table_Light").x;
-        u32 numFGTiles = (u32)std::ceil(GameConfig::k_levelWidth/m_fgSizeX) + 1;
-        m_groundTiles.reserve(numFGTiles);
-        m_ceilingTiles.reserve(numFGTiles);
-        xPos = GameConfig::k_cullX;
+        f32 fgSizeX = environmentAtlas->GetOriginalFrameSize("Table_Light").x;
         
-        for(u32 i=0; i<numFGTiles; ++i)
-        {
-            {
-                CS::EntitySPtr entity = CS::Entity::Create();
-                auto sprite = std::make_shared<CS::SpriteComponent>(environmentMaterial, environmentAtlas, "Table_Light", CS::Vector2::k_one, CS::SizePolicy::k_usePreferredSize);
-                sprite->SetOriginAlignment(CS::AlignmentAnchor::k_topRight);
-                entity->AddComponent(sprite);
-                GetState()->GetMainScene()->Add(entity);
-                entity->GetTransform().SetPosition(xPos, GameConfig::k_groundY + GameConfig::k_playerHeight * 0.1f, 1.0f);
-                m_groundTiles.push_back(entity);
-            }
-            {
-                CS::EntitySPtr entity = CS::Entity::Create();
-                auto sprite = std::make_shared<CS::SpriteComponent>(environmentMaterial, environmentAtlas, "Table_Light", CS::Vector2::k_one, CS::SizePolicy::k_usePreferredSize);
-                sprite->SetOriginAlignment(CS::AlignmentAnchor::k_bottomRight);
-                sprite->SetColour(0.25f, 0.25f, 0.25f, 1.0f);
-                sprite->SetFlippedVertically(true);
-                entity->AddComponent(sprite);
-                GetState()->GetMainScene()->Add(entity);
-                entity->GetTransform().SetPosition(xPos, GameConfig::k_ceilingY, -1.0f);
-                m_ceilingTiles.push_back(entity);
-            }
-            
-            xPos += m_fgSizeX;
-        }
+        m_groundStrip = TiledStripUPtr(new TiledStrip("GroundStrip", environmentMaterial, environmentAtlas, {"Table_Light"}, GameConfig::k_levelWidth + fgSizeX));
+        f32 groundTopY = GameConfig::k_groundY + GameConfig::k_playerHeight * 0.1f;
+        m_groundStrip->SetRestPosition(CS::Vector3(GameConfig::k_cullX - fgSizeX, groundTopY - m_groundStrip->GetHeight() * 0.5f, 1.0f));
+        GetState()->GetMainScene()->Add(m_groundStrip->GetEntity());
+        
+        m_ceilingStrip = TiledStripUPtr(new TiledStrip("CeilingStrip", environmentMaterial, environmentAtlas, {"Table_Light"}, GameConfig::k_levelWidth + fgSizeX, CS::Colour(0.25f, 0.25f, 0.25f, 1.0f), true));
+        m_ceilingStrip->SetRestPosition(CS::Vector3(GameConfig::k_cullX - fgSizeX, GameConfig::k_ceilingY + m_ceilingStrip->GetHeight() * 0.5f, -1.0f));
+        GetState()->GetMainScene()->Add(m_ceilingStrip->GetEntity());
     }
     
     //------------------------------------------------------------
     void LevelGeneratorSystem::OnUpdate(f32 timeSinceLastUpdate) noexcept
     {
-        //Move all obstacles horizontally
-        f32 scrollDist = -GameConfig::k_scrollSpeed * timeSinceLastUpdate;
-        for(std::size_t i=0; i<m_activeObstacles.size(); ++i)
+        if(m_manualStepping == false)
         {
-            m_activeObstacles[i]->GetTransform().MoveBy(scrollDist, 0.0f, 0.0f);
-            m_obstacleCollisionBoxes[i].vOrigin.x += scrollDist;
+            Step(timeSinceLastUpdate);
         }
-        
-        for(auto& bg : m_bgTiles)
-        {
-            bg->GetTransform().MoveBy(scrollDist, 0.0f, 0.0f);
-        }
-        
-        for(auto& ground : m_groundTiles)
-        {
-            ground->GetTransform().MoveBy(scrollDist, 0.0f, 0.0f);
-        }
-        
-        for(auto& ceiling : m_ceilingTiles)
-        {
-            ceiling->GetTransform().MoveBy(scrollDist, 0.0f, 0.0f);
-        }
-        
-        //If the left most object exist the left hand side bound then make it disappear
-        if(m_activeObstacles.size() > 0 && m_activeObstacles.front()->GetTransform().GetLocalPosition().x < GameConfig::k_cullX)
+    }
+    
+    //------------------------------------------------------------
+    void LevelGeneratorSystem::Step(f32 timeSinceLastUpdate) noexcept
+    {
+        //Scroll the world rather than each object in it. Obstacles and their collision bounds stay put in world-local space
+        //until the stream rebases them, which the strips are unaffected by as they track their own wrapped offset.
+        f32 rebaseShift = m_stream->Scroll(timeSinceLastUpdate);
+        if(rebaseShift != 0.0f)
         {
-            m_inactiveObstacles.push_back(m_activeObstacles.front());
-            m_activeObstacles.front()->RemoveFromParent();
-            m_activeObstacles.erase(m_activeObstacles.begin());
-            m_obstacleCollisionBoxes.erase(m_obstacleCollisionBoxes.begin());
+            const auto& obstacles = m_stream->GetObstacles();
+            for(u32 i=0; i<obstacles.GetCount(); ++i)
+            {
+                const auto& obstacle = obstacles.GetAt(i);
+                if(obstacle.m_alive == true)
+                {
+                    obstacle.m_entity->GetTransform().MoveBy(rebaseShift, 0.0f, 0.0f);
+                }
+            }
         }
         
-        if(m_bgTiles.front()->GetTransform().GetLocalPosition().x < GameConfig::k_cullX)
-        {
-            auto tile = m_bgTiles.front();
-            m_bgTiles.erase(m_bgTiles.begin());
-            m_bgTiles.push_back(tile);
-            m_bgTiles.back()->GetTransform().MoveBy(m_bgTiles.size() * m_bgSizeX, 0.0f, 0.0f);
-        }
+        f32 scrollDist = m_stream->GetFrameScrollDistance();
+        m_world->GetTransform().SetPosition(m_stream->GetScrollX(), 0.0f, 0.0f);
+        m_bgStrip->ScrollBy(scrollDist);
+        m_groundStrip->ScrollBy(scrollDist);
+        m_ceilingStrip->ScrollBy(scrollDist);
+#ifdef CSRUNNER_SCROLL_STATS
+        u32 transformUpdates = 4;
+#endif
         
-        if(m_groundTiles.front()->GetTransform().GetLocalPosition().x < GameConfig::k_cullX)
+        //Obstacles that exit the left hand side bound go back to the pool
+        u32 numInactiveObstacles = u32(m_inactiveObstacles.size());
+        m_stream->Cull(&m_inactiveObstacles);
+        for(u32 i=numInactiveObstacles; i<u32(m_inactiveObstacles.size()); ++i)
         {
-            auto tile = m_groundTiles.front();
-            m_groundTiles.erase(m_groundTiles.begin());
-            m_groundTiles.push_back(tile);
-            m_groundTiles.back()->GetTransform().MoveBy(m_groundTiles.size() * m_fgSizeX, 0.0f, 0.0f);
+            m_inactiveObstacles[i]->RemoveFromParent();
         }
         
-        if(m_ceilingTiles.front()->GetTransform().GetLocalPosition().x < GameConfig::k_cullX)
+        //If we have some obstacles in the pool then we can show the next one the stream spawns
+        if(m_inactiveObstacles.size() > 0)
         {
-            auto tile = m_ceilingTiles.front();
-            m_ceilingTiles.erase(m_ceilingTiles.begin());
-            m_ceilingTiles.push_back(tile);
-            m_ceilingTiles.back()->GetTransform().MoveBy(m_ceilingTiles.size() * m_fgSizeX, 0.0f, 0.0f);
+            const ObstacleDesc* desc = m_stream->TrySpawn(m_inactiveObstacles.back());
+            if(desc != nullptr)
+            {
+                auto entity = m_inactiveObstacles.back();
+                m_inactiveObstacles.pop_back();
+                entity->GetComponent<CS::SpriteComponent>()->SetTextureAtlasId(desc->m_atlasId);
+                
+                m_world->AddEntity(entity);
+                entity->GetTransform().SetPosition(m_stream->GetObstacles().GetBack().m_originX, desc->m_spawnY, 0.0f);
+#ifdef CSRUNNER_SCROLL_STATS
+                ++transformUpdates;
+#endif
+            }
         }
         
-        //If we have some obstacles in the pool and there is a great enough distance to the last object then we can spawn a new obstacle
-        if(m_activeObstacles.size() < GameConfig::k_maxObstacles && m_inactiveObstacles.size() > 0)
+#ifdef CSRUNNER_SCROLL_STATS
+        m_statsTransformUpdates += transformUpdates;
+        m_statsNumFrames++;
+        m_statsTimer += timeSinceLastUpdate;
+        if(m_statsTimer >= k_statsInterval)
         {
-            f32 minSpawnX = GameConfig::k_levelWidth * 1.2f;
-            f32 lastPos = m_activeObstacles.size() > 0 ? m_activeObstacles.back()->GetTransform().GetLocalPosition().x : 0.0f;
-            f32 distance = minSpawnX - lastPos;
+            //Scrolling each object individually would have cost one update per obstacle and tile every frame
+            u32 perObjectUpdates = m_stream->GetObstacles().GetCount() + m_bgStrip->GetNumTiles() + m_groundStrip->GetNumTiles() + m_ceilingStrip->GetNumTiles();
+            CS_LOG_VERBOSE("Scroll transform updates per frame: " + CS::ToString(f32(m_statsTransformUpdates) / f32(m_statsNumFrames)) + " (per-object scrolling: " + CS::ToString(perObjectUpdates) + ")");
             
-            if(distance >= GameConfig::k_minDistanceBetweenObstacles)
-            {
-                auto spriteComponent = m_inactiveObstacles.back()->GetComponent<CS::SpriteComponent>();
-                
-                //Decide whether to spawn a low or high object and then randomly pick and object
-                u32 index = WeightedRandom({GameConfig::k_lowObstacleProbability, GameConfig::k_highObstacleProbability});
-                f32 spawnY = 0.0f;
-                if(index == 0)
-                {
-                    spriteComponent->SetTextureAtlasId(k_potentialObstacleIdsBottom[CS::Random::Generate((std::size_t)0, k_potentialObstacleIdsBottom.size()-1)]);
-                    spawnY = GameConfig::k_groundY + GameConfig::k_lowObstacleSpawnOffset + spriteComponent->GetSize().y * 0.5f;
-                }
-                else
-                {
-                    spriteComponent->SetTextureAtlasId(k_potentialObstacleIdsTop[CS::Random::Generate((std::size_t)0, k_potentialObstacleIdsTop.size()-1)]);
-                    spawnY = GameConfig::k_groundY + GameConfig::k_highObstacleSpawnOffset + spriteComponent->GetSize().y * 0.5f;
-                }
-                
-                CS::Vector3 spawnPos(minSpawnX + CS::Random::Generate(GameConfig::k_minDistanceBetweenObstacles, GameConfig::k_maxDistanceBetweenObstacles), spawnY, 0.0f);
-                
-                m_activeObstacles.push_back(m_inactiveObstacles.back());
-                GetState()->GetMainScene()->Add(m_inactiveObstacles.back());
-                m_inactiveObstacles.back()->GetTransform().SetPosition(spawnPos);
-                m_obstacleCollisionBoxes.push_back(CS::Rectangle(spawnPos.XY() + CS::Vector2(-spriteComponent->GetSize().x * 0.5f, 0.0f), spriteComponent->GetSize()));
-                
-                m_inactiveObstacles.pop_back();
-            }
+            m_statsTransformUpdates = 0;
+            m_statsNumFrames = 0;
+            m_statsTimer = 0.0f;
         }
+#endif
         
-        //Update explosion animation
-        if(m_explosionEffect->GetScene() != nullptr)
+        //Hide the explosion once its animation has played
+        if(m_explosionEffect->GetScene() != nullptr && m_animationSystem->IsFinished(m_explosionAnimationId) == true)
         {
-            bool finished = m_explosionAnimation->Update(timeSinceLastUpdate, KeyframeAnimation::UpdateMode::k_once);
-            if(finished == true)
-            {
-                m_explosionEffect->RemoveFromParent();
-            }
+            m_explosionEffect->RemoveFromParent();
         }
     }
     
     //------------------------------------------------------------
-    void LevelGeneratorSystem::DestroyObstacle(u32 index) noexcept
+    void LevelGeneratorSystem::DestroyObstacle(const ObstacleHandle& handle) noexcept
     {
+        auto obstacle = m_stream->GetObstacles().TryGet(handle);
+        if(obstacle == nullptr)
+        {
+            return;
+        }
+        
         if(m_explosionEffect->GetScene() == nullptr)
         {
             GetState()->GetMainScene()->Add(m_explosionEffect);
         }
-        m_explosionAnimation->Reset();
-        m_explosionEffect->GetTransform().SetPosition(m_activeObstacles[index]->GetTransform().GetLocalPosition());
+        m_animationSystem->Restart(m_explosionAnimationId);
+        m_explosionEffect->GetTransform().SetPosition(obstacle->m_entity->GetTransform().GetWorldPosition());
         
-        m_activeObstacles[index]->RemoveFromParent();
-        m_inactiveObstacles.push_back(m_activeObstacles[index]);
-        m_activeObstacles.erase(m_activeObstacles.begin() + index);
-        m_obstacleCollisionBoxes.erase(m_obstacleCollisionBoxes.begin() + index);
+        obstacle->m_entity->RemoveFromParent();
+        m_inactiveObstacles.push_back(obstacle->m_entity);
+        m_stream->GetObstacles().Kill(*obstacle);
     }
 }
@@ -26,11 +26,15 @@
 #define _APPSOURCE_ENVIRONMENT_LEVELGENERATORSYSTEM_H_
 
 #include <ForwardDeclarations.h>
+#include <GameConfig.h>
 
 #include <ChilliSource/Core/System.h>
 #include <ChilliSource/Core/Math.h>
 
-#include <Animation/KeyframeAnimation.h>
+#include <Environment/LevelStream.h>
+#include <Environment/ObstacleCatalogue.h>
+#include <Environment/ObstacleSequencer.h>
+#include <Environment/TiledStrip.h>
 
 #include <vector>
 
@@ -38,7 +42,11 @@ namespace CSRunner
 {
     /// Responsible for spawning obstacles and scrolling them
     /// to simulate the player running. Ensures only a certain number of objects are
-    /// on screen at any time
+    /// on screen at any time. The scrolling, culling and spawning rules are the LevelStream's;
+    /// this system keeps the obstacle entities, strips and effects in step with it.
+    ///
+    /// When CSRUNNER_SCROLL_STATS is defined the number of transform updates made per frame
+    /// is logged every few seconds, against what scrolling each object individually would cost.
     ///
     class LevelGeneratorSystem final : public CS::StateSystem
     {
@@ -46,51 +54,90 @@ namespace CSRunner
         
         CS_DECLARE_NAMEDTYPE(LevelGeneratorSystem);
         
+        /// @param animationSystem
+        ///     Used to play the explosion effect
+        /// @param seed
+        ///     Seed for the obstacle stream. The same seed always produces the same level.
+        /// @param config
+        ///     Scroll speed, obstacle spacing and obstacle type probabilities
+        /// @param refillMode
+        ///     How the obstacle stream is generated. Background refills keep generation off the main
+        ///     thread but can delay a spawn if they fall behind; inline refills never miss an obstacle,
+        ///     so the layout depends only on the seed however fast the level is stepped.
         ///
-        static LevelGeneratorSystemUPtr Create() noexcept;
+        static LevelGeneratorSystemUPtr Create(AnimationSystem* animationSystem, u32 seed, const DifficultyConfig& config, ObstacleSequencer::RefillMode refillMode) noexcept;
         
         ///
         bool IsA(CS::InterfaceIDType interfaceId) const noexcept override;
         
         /// Called as a result of a collision between player and an obstacle.
-        /// The system will destroy the obstacle at the given index
+        /// The system will destroy the obstacle if the handle is still live
+        ///
+        /// @param handle
+        ///     Handle of hit obstacle
+        ///
+        void DestroyObstacle(const ObstacleHandle& handle) noexcept;
+        
+        /// @return The level's obstacles and scroll offset, which the obstacle entities are kept
+        ///     in step with
+        ///
+        const LevelStream& GetStream() const noexcept { return *m_stream; }
+        
+        /// @return Difficulty the level is generated with
         ///
-        /// @param index
-        ///     Index of hit obstacle
+        const DifficultyConfig& GetConfig() const noexcept { return m_config; }
+        
+        /// @param manualStepping
+        ///     Whether the system is only advanced by calls to Step() rather than every frame
         ///
-        void DestroyObstacle(u32 index) noexcept;
+        void SetManualStepping(bool manualStepping) noexcept { m_manualStepping = manualStepping; }
         
-        /// @return Axis aligned world collision boxes for current obstacles
+        /// Scrolls the world, culls obstacles that have left the screen and spawns new ones
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since the last step
         ///
-        const std::vector<CS::Rectangle>& GetObstacleCollisionBoxes() const noexcept { return m_obstacleCollisionBoxes; }
+        void Step(f32 timeSinceLastUpdate) noexcept;
         
     private:
         
         ///
-        LevelGeneratorSystem() = default;
+        LevelGeneratorSystem(AnimationSystem* animationSystem, u32 seed, const DifficultyConfig& config, ObstacleSequencer::RefillMode refillMode) noexcept;
         
-        /// Create obstacles
+        /// Create obstacles, build the catalogue they are spawned from and start
+        /// sequencing the obstacle stream
         ///
         void OnInit() noexcept override;
         
-        /// Move the objects and spawn new ones
+        /// Steps the system unless it is manually stepped
         ///
         void OnUpdate(f32 timeSinceLastUpdate) noexcept override;
         
-        std::vector<CS::Rectangle> m_obstacleCollisionBoxes;
+        AnimationSystem* m_animationSystem;
+        u32 m_seed;
+        DifficultyConfig m_config;
+        ObstacleSequencer::RefillMode m_refillMode;
         
-        std::vector<CS::EntitySPtr> m_activeObstacles;
+        CS::EntitySPtr m_world;
+        bool m_manualStepping = false;
+        
+        ObstacleCatalogueUPtr m_catalogue;
+        LevelStreamUPtr m_stream;
         std::vector<CS::EntitySPtr> m_inactiveObstacles;
         
-        std::vector<CS::EntitySPtr> m_bgTiles;
-        std::vector<CS::EntitySPtr> m_groundTiles;
-        std::vector<CS::EntitySPtr> m_ceilingTiles;
+        TiledStripUPtr m_bgStrip;
+        TiledStripUPtr m_groundStrip;
+        TiledStripUPtr m_ceilingStrip;
         
         CS::EntitySPtr m_explosionEffect;
-        KeyframeAnimationUPtr m_explosionAnimation;
+        AnimationClipTableCSPtr m_effectsClips;
+        u32 m_explosionAnimationId = 0;
         
-        f32 m_bgSizeX = 0.0f;
-        f32 m_fgSizeX = 0.0f;
+#ifdef CSRUNNER_SCROLL_STATS
+        u32 m_statsTransformUpdates = 0;
+        u32 m_statsNumFrames = 0;
+        f32 m_statsTimer = 0.0f;
+#endif
     };
 }
 
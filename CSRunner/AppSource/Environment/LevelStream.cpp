@@ -0,0 +1,149 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Environment/LevelStream.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <Environment/ObstacleCatalogue.h>
+#include <Environment/ObstacleSequencer.h>
+
+#include <algorithm>
+
+namespace CSRunner
+{
+    namespace
+    {
+        /// Once the world has scrolled this far it is shifted back to the origin
+        ///
+        constexpr f32 k_rebaseDistance = GameConfig::k_levelWidth * 100.0f;
+        
+        /// Obstacles spawn this far right of the origin, which is offscreen
+        ///
+        constexpr f32 k_spawnX = GameConfig::k_levelWidth * 1.2f;
+    }
+    
+    //------------------------------------------------------------
+    LevelStream::LevelStream(const DifficultyConfig& config, const ObstacleCatalogue& catalogue, const ObstacleSequencerSPtr& sequencer) noexcept
+    : m_config(config), m_catalogue(catalogue), m_sequencer(sequencer), m_obstacles(GameConfig::k_maxObstacles)
+    {
+        //The first obstacle is placed one gap beyond this
+        m_lastSpawnX = k_spawnX - m_config.m_minDistanceBetweenObstacles;
+    }
+    
+    //------------------------------------------------------------
+    f32 LevelStream::Scroll(f32 timeSinceLastUpdate) noexcept
+    {
+        m_frameScrollDistance = -m_config.m_scrollSpeed * timeSinceLastUpdate;
+        m_scrollX += m_frameScrollDistance;
+        if(m_scrollX >= -k_rebaseDistance)
+        {
+            return 0.0f;
+        }
+        
+        f32 shift = m_scrollX;
+        for(u32 i=0; i<m_obstacles.GetCount(); ++i)
+        {
+            auto& obstacle = m_obstacles.GetAt(i);
+            obstacle.m_bounds.vOrigin.x += shift;
+            obstacle.m_originX += shift;
+        }
+        
+        m_lastSpawnX += shift;
+        m_scrollX = 0.0f;
+        return shift;
+    }
+    
+    //------------------------------------------------------------
+    void LevelStream::Cull(std::vector<CS::EntitySPtr>* out_culledEntities) noexcept
+    {
+        while(m_obstacles.GetCount() > 0)
+        {
+            auto& front = m_obstacles.GetFront();
+            if(front.m_alive == true)
+            {
+                if(front.m_originX + m_scrollX >= GameConfig::k_cullX)
+                {
+                    break;
+                }
+                
+                if(out_culledEntities != nullptr && front.m_entity != nullptr)
+                {
+                    out_culledEntities->push_back(front.m_entity);
+                }
+                m_obstacles.Kill(front);
+            }
+            
+            m_obstacles.PopFront();
+        }
+    }
+    
+    //------------------------------------------------------------
+    const ObstacleDesc* LevelStream::TrySpawn(const CS::EntitySPtr& entity) noexcept
+    {
+        if(m_obstacles.IsFull() == true)
+        {
+            return nullptr;
+        }
+        
+        //Obstacles are placed relative to the previous one so the layout depends only on the seed, not the frame rate
+        f32 distance = k_spawnX - (m_lastSpawnX + m_scrollX);
+        
+        PlannedObstacle planned;
+        if(distance < m_config.m_minDistanceBetweenObstacles || m_sequencer->TryPop(planned) == false)
+        {
+            return nullptr;
+        }
+        
+        const auto& desc = m_catalogue.GetObstacle(planned.m_type, planned.m_catalogueIndex);
+        
+        f32 spawnX = std::max(m_lastSpawnX + planned.m_gap, k_spawnX - m_scrollX);
+        CS::Vector2 spawnPos(spawnX, desc.m_spawnY);
+        
+        m_obstacles.PushBack(entity, spawnX, CS::Rectangle(spawnPos + desc.m_collisionBox.vOrigin, desc.m_collisionBox.vSize), planned.m_type);
+        m_lastSpawnX = spawnX;
+        return &desc;
+    }
+    
+    //------------------------------------------------------------
+    const ObstacleRecord* LevelStream::FindFirstHit(const CS::Rectangle& playerBox, const CS::Rectangle* previousPlayerBox) const noexcept
+    {
+        //Bring the player into the world-local space of the obstacle bounds
+        CS::Rectangle box = playerBox;
+        box.vOrigin.x -= m_scrollX;
+        
+        //The previous scroll is taken relative to the current one so that it survives the world rebasing
+        if(previousPlayerBox != nullptr)
+        {
+            f32 previousX = previousPlayerBox->vOrigin.x - (m_scrollX - m_frameScrollDistance);
+            f32 left = std::min(box.vOrigin.x - box.vSize.x * 0.5f, previousX - previousPlayerBox->vSize.x * 0.5f);
+            f32 right = std::max(box.vOrigin.x + box.vSize.x * 0.5f, previousX + previousPlayerBox->vSize.x * 0.5f);
+            
+            box.vOrigin.x = (left + right) * 0.5f;
+            box.vSize.x = right - left;
+        }
+        
+        return m_obstacles.FindFirstOverlap(box);
+    }
+}
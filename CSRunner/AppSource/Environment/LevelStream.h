@@ -0,0 +1,131 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ENVIRONMENT_LEVELSTREAM_H_
+#define _APPSOURCE_ENVIRONMENT_LEVELSTREAM_H_
+
+#include <ForwardDeclarations.h>
+#include <GameConfig.h>
+
+#include <ChilliSource/Core/Math.h>
+
+#include <Environment/ObstacleRing.h>
+
+#include <vector>
+
+namespace CSRunner
+{
+    /// The rules of the scrolling level with no entities attached: scrolling and rebasing the
+    /// world, culling obstacles that have left the screen, spawning the planned obstacle stream
+    /// and sweeping the player against what remains. The LevelGeneratorSystem wraps this with
+    /// the entities that show the level and the RunSimulation steps it directly, so the same
+    /// seed and config play out the same in both.
+    ///
+    /// Obstacle bounds and origins are local to the scrolling world; add the scroll offset to
+    /// convert them to world space.
+    ///
+    class LevelStream final
+    {
+    public:
+        
+        /// @param config
+        ///     Scroll speed and obstacle spacing
+        /// @param catalogue
+        ///     Obstacle descriptions. Must outlive the stream.
+        /// @param sequencer
+        ///     Source of the planned obstacles
+        ///
+        LevelStream(const DifficultyConfig& config, const ObstacleCatalogue& catalogue, const ObstacleSequencerSPtr& sequencer) noexcept;
+        
+        /// @return Current obstacles, in spawn order
+        ///
+        ObstacleRing& GetObstacles() noexcept { return m_obstacles; }
+        
+        /// @return Current obstacles, in spawn order
+        ///
+        const ObstacleRing& GetObstacles() const noexcept { return m_obstacles; }
+        
+        /// @return Horizontal offset of the scrolling world
+        ///
+        f32 GetScrollX() const noexcept { return m_scrollX; }
+        
+        /// @return Distance the world scrolled during the last step, negative as it scrolls left
+        ///
+        f32 GetFrameScrollDistance() const noexcept { return m_frameScrollDistance; }
+        
+        /// Scrolls the world. Once it has scrolled far enough every obstacle is shifted back
+        /// by the scroll offset, which is reset to zero, to keep world-local positions small
+        /// enough to hold precision.
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since the last step
+        ///
+        /// @return Distance every obstacle was shifted by, or zero if the world wasn't rebased
+        ///
+        f32 Scroll(f32 timeSinceLastUpdate) noexcept;
+        
+        /// Pops live obstacles whose origin has left the screen from the front, along with any
+        /// destroyed obstacles that have reached it
+        ///
+        /// @param out_culledEntities
+        ///     Entities of the live obstacles culled are appended to this. May be null.
+        ///
+        void Cull(std::vector<CS::EntitySPtr>* out_culledEntities) noexcept;
+        
+        /// Spawns the next planned obstacle, one gap beyond the previous, once there is room for
+        /// it. Never spawns on screen, even if spawning was held up. The new record is the
+        /// back of the obstacles.
+        ///
+        /// @param entity
+        ///     Entity to show the obstacle with. May be null.
+        ///
+        /// @return Description of the obstacle spawned, or null if there was none
+        ///
+        const ObstacleDesc* TrySpawn(const CS::EntitySPtr& entity) noexcept;
+        
+        /// @param playerBox
+        ///     Player's collision box in world space
+        /// @param previousPlayerBox
+        ///     Player's collision box in world space at the last step. May be null.
+        ///
+        /// @return The leftmost live obstacle overlapping the player box swept back to where
+        ///     the player was in the world last step, so that a long step can't carry an obstacle
+        ///     straight past them. Null if there is none.
+        ///
+        const ObstacleRecord* FindFirstHit(const CS::Rectangle& playerBox, const CS::Rectangle* previousPlayerBox) const noexcept;
+        
+    private:
+        
+        DifficultyConfig m_config;
+        const ObstacleCatalogue& m_catalogue;
+        ObstacleSequencerSPtr m_sequencer;
+        
+        ObstacleRing m_obstacles;
+        f32 m_scrollX = 0.0f;
+        f32 m_frameScrollDistance = 0.0f;
+        f32 m_lastSpawnX = 0.0f;
+    };
+}
+
+#endif
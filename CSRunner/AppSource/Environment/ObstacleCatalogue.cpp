@@ -0,0 +1,129 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Environment/ObstacleCatalogue.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Rendering/Texture.h>
+
+#include <GameConfig.h>
+
+#include <algorithm>
+
+namespace CSRunner
+{
+    namespace
+    {
+        /// Per-obstacle entry in the catalogue. The collision scale shrinks the box about the
+        /// sprite centre to trim transparent edges.
+        ///
+        struct ObstacleDefinition final
+        {
+            const char* m_atlasId;
+            ObstacleType m_type;
+            CS::Vector2 m_collisionScale;
+        };
+        
+        const ObstacleDefinition k_obstacleDefinitions[] =
+        {
+            { "Balloons_Light", ObstacleType::k_high, CS::Vector2(0.8f, 1.0f) },
+            { "Chandelier_Light", ObstacleType::k_high, CS::Vector2(0.9f, 1.0f) },
+            { "Pinata_Light", ObstacleType::k_high, CS::Vector2(0.8f, 1.0f) },
+            { "CakeStand_Light", ObstacleType::k_low, CS::Vector2(0.8f, 0.9f) },
+            { "Champagne_Light", ObstacleType::k_low, CS::Vector2(0.8f, 0.9f) },
+            { "Chicken_Light", ObstacleType::k_low, CS::Vector2(0.9f, 0.9f) },
+            { "Flower_Light", ObstacleType::k_low, CS::Vector2(0.7f, 0.9f) },
+            { "Plates_Light", ObstacleType::k_low, CS::Vector2(0.9f, 0.9f) }
+        };
+    }
+    
+    //------------------------------------------------------------
+    ObstacleCatalogue::ObstacleCatalogue(const CS::TextureAtlas* atlas) noexcept
+    {
+        CS_ASSERT(atlas != nullptr, "Cannot build obstacle catalogue without an atlas.");
+        
+        for(const auto& definition : k_obstacleDefinitions)
+        {
+            ObstacleDesc desc;
+            desc.m_atlasId = definition.m_atlasId;
+            desc.m_type = definition.m_type;
+            desc.m_size = atlas->GetOriginalFrameSize(desc.m_atlasId);
+            
+            f32 spawnOffset = definition.m_type == ObstacleType::k_low ? GameConfig::k_lowObstacleSpawnOffset : GameConfig::k_highObstacleSpawnOffset;
+            desc.m_spawnY = GameConfig::k_groundY + spawnOffset + desc.m_size.y * 0.5f;
+            
+            //Obstacles are aligned middle right so the sprite centre is half a width to the left of the origin
+            CS::Vector2 collisionSize = desc.m_size * definition.m_collisionScale;
+            desc.m_collisionBox = CS::Rectangle(CS::Vector2(-desc.m_size.x * 0.5f, 0.0f), collisionSize);
+            
+            //Collision relies on obstacles being further apart than they are wide so that their edges stay in spawn order
+            CS_ASSERT(collisionSize.x < GameConfig::k_minDistanceBetweenObstacles, "Obstacle is wider than the minimum spawn distance.");
+            m_maxCollisionWidth = std::max(m_maxCollisionWidth, collisionSize.x);
+            
+            if(desc.m_type == ObstacleType::k_low)
+            {
+                m_lowObstacles.push_back(std::move(desc));
+            }
+            else
+            {
+                m_highObstacles.push_back(std::move(desc));
+            }
+        }
+    }
+    
+    //------------------------------------------------------------
+    u32 ObstacleCatalogue::GetNumObstacles(ObstacleType type) const noexcept
+    {
+        return type == ObstacleType::k_low ? u32(m_lowObstacles.size()) : u32(m_highObstacles.size());
+    }
+    
+    //------------------------------------------------------------
+    const ObstacleDesc& ObstacleCatalogue::GetObstacle(ObstacleType type, u32 index) const noexcept
+    {
+        const auto& obstacles = type == ObstacleType::k_low ? m_lowObstacles : m_highObstacles;
+        CS_ASSERT(index < u32(obstacles.size()), "Obstacle index out of bounds.");
+        
+        return obstacles[index];
+    }
+    
+    //------------------------------------------------------------
+    bool ObstacleCatalogue::FindObstacle(const std::string& atlasId, ObstacleType& out_type, u32& out_index) const noexcept
+    {
+        for(auto type : { ObstacleType::k_low, ObstacleType::k_high })
+        {
+            const auto& obstacles = type == ObstacleType::k_low ? m_lowObstacles : m_highObstacles;
+            for(u32 i = 0; i < u32(obstacles.size()); ++i)
+            {
+                if(obstacles[i].m_atlasId == atlasId)
+                {
+                    out_type = type;
+                    out_index = i;
+                    return true;
+                }
+            }
+        }
+        
+        return false;
+    }
+}
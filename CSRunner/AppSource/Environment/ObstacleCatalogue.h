@@ -0,0 +1,104 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ENVIRONMENT_OBSTACLECATALOGUE_H_
+#define _APPSOURCE_ENVIRONMENT_OBSTACLECATALOGUE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Math.h>
+
+#include <Environment/ObstacleRing.h>
+
+#include <string>
+#include <vector>
+
+namespace CSRunner
+{
+    /// Everything needed to spawn one kind of obstacle, derived once from the atlas
+    ///
+    struct ObstacleDesc final
+    {
+        std::string m_atlasId;
+        ObstacleType m_type = ObstacleType::k_low;
+        CS::Vector2 m_size;
+        /// Y position of the obstacle's origin
+        f32 m_spawnY = 0.0f;
+        /// Collision box relative to the obstacle's origin. May be tighter than the sprite.
+        CS::Rectangle m_collisionBox;
+    };
+    
+    /// Table of every obstacle that can be spawned, grouped by type. Sizes, spawn heights
+    /// and collision boxes are constant so are resolved from the atlas on construction
+    /// rather than queried from the sprite on each spawn.
+    ///
+    class ObstacleCatalogue final
+    {
+    public:
+        
+        /// @param atlas
+        ///     Obstacles atlas from which the frame sizes are read
+        ///
+        ObstacleCatalogue(const CS::TextureAtlas* atlas) noexcept;
+        
+        /// @param type
+        ///     Low or high obstacles
+        ///
+        /// @return Number of obstacles of the given type
+        ///
+        u32 GetNumObstacles(ObstacleType type) const noexcept;
+        
+        /// @param type
+        ///     Low or high obstacles
+        /// @param index
+        ///     Index within that type, less than GetNumObstacles(type)
+        ///
+        /// @return Description of the obstacle
+        ///
+        const ObstacleDesc& GetObstacle(ObstacleType type, u32 index) const noexcept;
+        
+        /// @param atlasId
+        ///     Atlas id of the obstacle
+        /// @param out_type
+        ///     Receives the obstacle's type if found
+        /// @param out_index
+        ///     Receives the obstacle's index within its type if found
+        ///
+        /// @return Whether the catalogue contains the obstacle
+        ///
+        bool FindObstacle(const std::string& atlasId, ObstacleType& out_type, u32& out_index) const noexcept;
+        
+        /// @return Width of the widest collision box. Obstacles must be spaced further apart than this.
+        ///
+        f32 GetMaxCollisionWidth() const noexcept { return m_maxCollisionWidth; }
+        
+    private:
+        
+        std::vector<ObstacleDesc> m_lowObstacles;
+        std::vector<ObstacleDesc> m_highObstacles;
+        f32 m_maxCollisionWidth = 0.0f;
+    };
+}
+
+#endif
@@ -0,0 +1,171 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Environment/ObstaclePatternLibrary.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <Common/BinaryData.h>
+
+#include <cmath>
+
+namespace CSRunner
+{
+    CS_DEFINE_NAMEDTYPE(ObstaclePatternLibrary);
+    
+    namespace
+    {
+        const u32 k_fileId = 0x54505343; //"CSPT"
+        const u32 k_fileVersion = 1;
+        
+        const u32 k_headerSize = 6 * sizeof(u32);
+        const u32 k_nameSize = 2 * sizeof(u32);
+        const u32 k_difficultySize = 2 * sizeof(u32);
+        const u32 k_patternSize = 2 * sizeof(u32);
+        
+        static_assert(sizeof(ObstaclePatternEntry) == 2 * sizeof(u32), "Pattern entries must match the file layout.");
+    }
+    
+    //------------------------------------------------------------
+    ObstaclePatternLibraryUPtr ObstaclePatternLibrary::Create() noexcept
+    {
+        return ObstaclePatternLibraryUPtr(new ObstaclePatternLibrary());
+    }
+    
+    //------------------------------------------------------------
+    bool ObstaclePatternLibrary::IsA(CS::InterfaceIDType interfaceId) const noexcept
+    {
+        return interfaceId == ObstaclePatternLibrary::InterfaceID;
+    }
+    
+    //------------------------------------------------------------
+    bool ObstaclePatternLibrary::Build(std::unique_ptr<const u8[]> data, u32 dataSize) noexcept
+    {
+        using BinaryData::Read;
+        
+        const u8* bytes = data.get();
+        
+        if(dataSize < k_headerSize || Read<u32>(bytes, 0) != k_fileId || Read<u32>(bytes, 4) != k_fileVersion)
+        {
+            CS_LOG_ERROR("Obstacle pattern library '" + GetName() + "' has an unrecognised header.");
+            return false;
+        }
+        
+        u32 numNames = Read<u32>(bytes, 8);
+        u32 numDifficulties = Read<u32>(bytes, 12);
+        u32 numPatterns = Read<u32>(bytes, 16);
+        u32 numEntries = Read<u32>(bytes, 20);
+        
+        BinaryData::SectionLayout layout(k_headerSize);
+        u32 namesOffset = layout.AddSection(numNames, k_nameSize);
+        u32 difficultiesOffset = layout.AddSection(numDifficulties, k_difficultySize);
+        u32 patternsOffset = layout.AddSection(numPatterns, k_patternSize);
+        u32 entriesOffset = layout.AddSection(numEntries, sizeof(ObstaclePatternEntry));
+        if(layout.Fits(dataSize) == false)
+        {
+            CS_LOG_ERROR("Obstacle pattern library '" + GetName() + "' is truncated.");
+            return false;
+        }
+        
+        u32 stringsOffset = layout.GetEnd();
+        m_obstacleNames.resize(numNames);
+        for(u32 i = 0; i < numNames; ++i)
+        {
+            if(BinaryData::TryReadString(bytes, dataSize, stringsOffset, namesOffset + i * k_nameSize, m_obstacleNames[i]) == false)
+            {
+                CS_LOG_ERROR("Obstacle pattern library '" + GetName() + "' has an invalid obstacle name.");
+                return false;
+            }
+        }
+        
+        //Everything else is read in place from the file data
+        const u32* difficulties = reinterpret_cast<const u32*>(bytes + difficultiesOffset);
+        const u32* patterns = reinterpret_cast<const u32*>(bytes + patternsOffset);
+        const ObstaclePatternEntry* entries = reinterpret_cast<const ObstaclePatternEntry*>(bytes + entriesOffset);
+        
+        for(u32 i = 0; i < numDifficulties; ++i)
+        {
+            if(BinaryData::IsRangeInBounds(difficulties[i * 2], difficulties[i * 2 + 1], numPatterns) == false)
+            {
+                CS_LOG_ERROR("Obstacle pattern library '" + GetName() + "' has an invalid difficulty.");
+                return false;
+            }
+        }
+        
+        for(u32 i = 0; i < numPatterns; ++i)
+        {
+            if(patterns[i * 2 + 1] == 0 || BinaryData::IsRangeInBounds(patterns[i * 2], patterns[i * 2 + 1], numEntries) == false)
+            {
+                CS_LOG_ERROR("Obstacle pattern library '" + GetName() + "' has an invalid pattern.");
+                return false;
+            }
+        }
+        
+        for(u32 i = 0; i < numEntries; ++i)
+        {
+            if(entries[i].m_obstacle >= numNames)
+            {
+                CS_LOG_ERROR("Obstacle pattern library '" + GetName() + "' has an invalid obstacle.");
+                return false;
+            }
+            
+            //A NaN gap would survive the sequencer's clamp to the minimum gap and poison every later spawn position
+            if((entries[i].m_gap >= 0.0f && std::isfinite(entries[i].m_gap)) == false)
+            {
+                CS_LOG_ERROR("Obstacle pattern library '" + GetName() + "' has an invalid gap.");
+                return false;
+            }
+        }
+        
+        m_numDifficulties = numDifficulties;
+        m_difficulties = difficulties;
+        m_patterns = patterns;
+        m_entries = entries;
+        m_data = std::move(data);
+        return true;
+    }
+    
+    //------------------------------------------------------------
+    const std::string& ObstaclePatternLibrary::GetObstacleName(u32 index) const noexcept
+    {
+        CS_ASSERT(index < u32(m_obstacleNames.size()), "Obstacle name index out of bounds.");
+        return m_obstacleNames[index];
+    }
+    
+    //------------------------------------------------------------
+    u32 ObstaclePatternLibrary::GetNumPatterns(u32 difficulty) const noexcept
+    {
+        CS_ASSERT(difficulty < m_numDifficulties, "Difficulty out of bounds.");
+        return m_difficulties[difficulty * 2 + 1];
+    }
+    
+    //------------------------------------------------------------
+    ArrayView<ObstaclePatternEntry> ObstaclePatternLibrary::GetPattern(u32 difficulty, u32 index) const noexcept
+    {
+        CS_ASSERT(index < GetNumPatterns(difficulty), "Pattern index out of bounds.");
+        
+        const u32* pattern = m_patterns + (m_difficulties[difficulty * 2] + index) * 2;
+        return ArrayView<ObstaclePatternEntry>(m_entries + pattern[0], pattern[1]);
+    }
+}
@@ -0,0 +1,126 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ENVIRONMENT_OBSTACLEPATTERNLIBRARY_H_
+#define _APPSOURCE_ENVIRONMENT_OBSTACLEPATTERNLIBRARY_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Resource.h>
+
+#include <Common/ArrayView.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CSRunner
+{
+    /// One obstacle within an authored pattern. Laid out exactly as in the file so
+    /// patterns are viewed in place.
+    ///
+    struct ObstaclePatternEntry final
+    {
+        /// Index into the library's obstacle names
+        u32 m_obstacle;
+        /// Distance from the previous obstacle's origin
+        f32 m_gap;
+    };
+    
+    /// Resource holding the authored obstacle patterns built from Patterns.json by the content
+    /// pipeline (see obstacle_pattern_builder.py). The file is read into a single buffer and
+    /// patterns are views straight into it, grouped by difficulty, so picking a pattern is an
+    /// index and streaming one is a walk along contiguous entries.
+    ///
+    class ObstaclePatternLibrary final : public CS::Resource
+    {
+    public:
+        
+        CS_DECLARE_NAMEDTYPE(ObstaclePatternLibrary);
+        
+        ///
+        bool IsA(CS::InterfaceIDType interfaceId) const noexcept override;
+        
+        /// Builds the library from the contents of a cspatterns file
+        ///
+        /// @param data
+        ///     File contents, which the library takes ownership of
+        /// @param dataSize
+        ///     Size of the data in bytes
+        ///
+        /// @return Whether the data was a valid pattern library
+        ///
+        bool Build(std::unique_ptr<const u8[]> data, u32 dataSize) noexcept;
+        
+        /// @return Number of distinct obstacles referenced by the patterns
+        ///
+        u32 GetNumObstacleNames() const noexcept { return u32(m_obstacleNames.size()); }
+        
+        /// @param index
+        ///     Index of the obstacle, as stored in each entry
+        ///
+        /// @return Atlas id of the obstacle
+        ///
+        const std::string& GetObstacleName(u32 index) const noexcept;
+        
+        /// @return Number of difficulty levels, from 0 the easiest
+        ///
+        u32 GetNumDifficulties() const noexcept { return m_numDifficulties; }
+        
+        /// @param difficulty
+        ///     Difficulty level
+        ///
+        /// @return Number of patterns at that difficulty
+        ///
+        u32 GetNumPatterns(u32 difficulty) const noexcept;
+        
+        /// @param difficulty
+        ///     Difficulty level
+        /// @param index
+        ///     Index of the pattern within that difficulty
+        ///
+        /// @return Obstacles in the pattern, in spawn order. Valid for the lifetime of the library.
+        ///
+        ArrayView<ObstaclePatternEntry> GetPattern(u32 difficulty, u32 index) const noexcept;
+        
+    private:
+        
+        friend class CS::ResourcePool;
+        
+        ///
+        static ObstaclePatternLibraryUPtr Create() noexcept;
+        
+        ///
+        ObstaclePatternLibrary() = default;
+        
+        std::unique_ptr<const u8[]> m_data;
+        std::vector<std::string> m_obstacleNames;
+        u32 m_numDifficulties = 0;
+        const u32* m_difficulties = nullptr;
+        const u32* m_patterns = nullptr;
+        const ObstaclePatternEntry* m_entries = nullptr;
+    };
+}
+
+#endif
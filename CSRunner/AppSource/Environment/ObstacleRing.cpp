@@ -0,0 +1,182 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Environment/ObstacleRing.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Math.h>
+
+namespace CSRunner
+{
+    //------------------------------------------------------------
+    ObstacleRing::ObstacleRing(u32 capacity) noexcept
+    : m_slots(capacity)
+    {
+        CS_ASSERT(capacity > 0, "Obstacle ring must have capacity.");
+    }
+    
+    //------------------------------------------------------------
+    ObstacleHandle ObstacleRing::PushBack(const CS::EntitySPtr& entity, f32 originX, const CS::Rectangle& bounds, ObstacleType type) noexcept
+    {
+        CS_ASSERT(IsFull() == false, "Obstacle ring is full.");
+        
+        u32 slot = (m_head + m_count) % u32(m_slots.size());
+        ++m_count;
+        
+        ObstacleRecord& record = m_slots[slot];
+        record.m_entity = entity;
+        record.m_originX = originX;
+        record.m_bounds = bounds;
+        record.m_type = type;
+        record.m_alive = true;
+        
+        ObstacleHandle handle;
+        handle.m_slot = slot;
+        handle.m_generation = record.m_generation;
+        return handle;
+    }
+    
+    //------------------------------------------------------------
+    ObstacleRecord& ObstacleRing::GetFront() noexcept
+    {
+        CS_ASSERT(m_count > 0, "Obstacle ring is empty.");
+        return m_slots[m_head];
+    }
+    
+    //------------------------------------------------------------
+    const ObstacleRecord& ObstacleRing::GetBack() const noexcept
+    {
+        CS_ASSERT(m_count > 0, "Obstacle ring is empty.");
+        return m_slots[(m_head + m_count - 1) % u32(m_slots.size())];
+    }
+    
+    //------------------------------------------------------------
+    void ObstacleRing::PopFront() noexcept
+    {
+        CS_ASSERT(m_count > 0, "Obstacle ring is empty.");
+        CS_ASSERT(m_slots[m_head].m_alive == false, "Obstacle must be killed before it is popped.");
+        
+        m_slots[m_head].m_entity.reset();
+        m_head = (m_head + 1) % u32(m_slots.size());
+        --m_count;
+    }
+    
+    //------------------------------------------------------------
+    ObstacleRecord* ObstacleRing::TryGet(const ObstacleHandle& handle) noexcept
+    {
+        if(handle.m_slot >= m_slots.size())
+        {
+            return nullptr;
+        }
+        
+        ObstacleRecord& record = m_slots[handle.m_slot];
+        if(record.m_alive == false || record.m_generation != handle.m_generation)
+        {
+            return nullptr;
+        }
+        
+        return &record;
+    }
+    
+    //------------------------------------------------------------
+    void ObstacleRing::Kill(ObstacleRecord& record) noexcept
+    {
+        CS_ASSERT(record.m_alive == true, "Obstacle is already dead.");
+        
+        record.m_alive = false;
+        ++record.m_generation;
+    }
+    
+    //------------------------------------------------------------
+    ObstacleRecord& ObstacleRing::GetAt(u32 index) noexcept
+    {
+        CS_ASSERT(index < m_count, "Obstacle ring index out of bounds.");
+        return m_slots[(m_head + index) % u32(m_slots.size())];
+    }
+    
+    //------------------------------------------------------------
+    const ObstacleRecord& ObstacleRing::GetAt(u32 index) const noexcept
+    {
+        CS_ASSERT(index < m_count, "Obstacle ring index out of bounds.");
+        return m_slots[(m_head + index) % u32(m_slots.size())];
+    }
+    
+    //------------------------------------------------------------
+    u32 ObstacleRing::FindFirstEndingAfter(f32 x) const noexcept
+    {
+        u32 first = 0;
+        u32 last = m_count;
+        while(first < last)
+        {
+            u32 middle = first + (last - first) / 2;
+            const auto& bounds = GetAt(middle).m_bounds;
+            if(bounds.vOrigin.x + bounds.vSize.x * 0.5f > x)
+            {
+                last = middle;
+            }
+            else
+            {
+                first = middle + 1;
+            }
+        }
+        
+        return first;
+    }
+    
+    //------------------------------------------------------------
+    const ObstacleRecord* ObstacleRing::FindFirstOverlap(const CS::Rectangle& box) const noexcept
+    {
+        f32 boxLeft = box.vOrigin.x - box.vSize.x * 0.5f;
+        f32 boxRight = box.vOrigin.x + box.vSize.x * 0.5f;
+        
+        //Records spawn further apart than they are wide, so their left edges are ordered as well as their right.
+        //Skip straight to the first that ends past the box and stop once they start beyond it.
+        for(u32 i = FindFirstEndingAfter(boxLeft); i < m_count; ++i)
+        {
+            const auto& record = GetAt(i);
+            if(record.m_bounds.vOrigin.x - record.m_bounds.vSize.x * 0.5f > boxRight)
+            {
+                break;
+            }
+            
+            if(record.m_alive == true && CS::ShapeIntersection::Intersects(box, record.m_bounds) == true)
+            {
+                return &record;
+            }
+        }
+        
+        return nullptr;
+    }
+    
+    //------------------------------------------------------------
+    ObstacleHandle ObstacleRing::GetHandle(const ObstacleRecord& record) const noexcept
+    {
+        CS_ASSERT(&record >= m_slots.data() && &record < m_slots.data() + m_slots.size(), "Record is not held in this ring.");
+        
+        ObstacleHandle handle;
+        handle.m_slot = u32(&record - m_slots.data());
+        handle.m_generation = record.m_generation;
+        return handle;
+    }
+}
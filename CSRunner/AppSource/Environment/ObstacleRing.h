@@ -0,0 +1,181 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ENVIRONMENT_OBSTACLERING_H_
+#define _APPSOURCE_ENVIRONMENT_OBSTACLERING_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Math.h>
+
+#include <vector>
+
+namespace CSRunner
+{
+    /// Whether an obstacle sits on the ground, to be jumped, or hangs high, to be slid under
+    ///
+    enum class ObstacleType
+    {
+        k_low,
+        k_high
+    };
+    
+    /// Stable reference to an obstacle. Remains safe to use after the obstacle has been culled
+    /// or destroyed, at which point it no longer resolves to a record.
+    ///
+    struct ObstacleHandle final
+    {
+        u32 m_slot = 0;
+        u32 m_generation = 0;
+    };
+    
+    /// A single spawned obstacle
+    ///
+    struct ObstacleRecord final
+    {
+        CS::EntitySPtr m_entity;
+        /// Spawn x of the entity origin, which is the sprite's right edge, local to the scrolling world
+        f32 m_originX = 0.0f;
+        /// Collision bounds, local to the scrolling world
+        CS::Rectangle m_bounds;
+        ObstacleType m_type = ObstacleType::k_low;
+        u32 m_generation = 0;
+        bool m_alive = false;
+    };
+    
+    /// Fixed capacity ring buffer of obstacle records in spawn order, which is also left to right
+    /// order as obstacles scroll at the same speed. Spawning pushes to the back and culling pops from
+    /// the front. Destroying an obstacle in the middle only clears its alive flag; the dead record is
+    /// popped once it reaches the front. All three are O(1) and never move other records, so handles
+    /// and the slot storage stay stable.
+    ///
+    class ObstacleRing final
+    {
+    public:
+        
+        /// @param capacity
+        ///     Maximum number of records, alive or dead, held at once
+        ///
+        ObstacleRing(u32 capacity) noexcept;
+        
+        /// @return Number of records, alive or dead, currently held
+        ///
+        u32 GetCount() const noexcept { return m_count; }
+        
+        /// @return TRUE if no more obstacles can be spawned until one is popped
+        ///
+        bool IsFull() const noexcept { return m_count == u32(m_slots.size()); }
+        
+        /// Adds a live record at the back. Must not be full.
+        ///
+        /// @param entity
+        ///     Obstacle entity. May be null.
+        /// @param originX
+        ///     Spawn x of the entity origin
+        /// @param bounds
+        ///     Collision bounds
+        /// @param type
+        ///     Obstacle type
+        ///
+        /// @return Handle to the new record
+        ///
+        ObstacleHandle PushBack(const CS::EntitySPtr& entity, f32 originX, const CS::Rectangle& bounds, ObstacleType type) noexcept;
+        
+        /// @return The oldest record, alive or dead. Must not be empty.
+        ///
+        ObstacleRecord& GetFront() noexcept;
+        
+        /// @return The newest record, alive or dead. Must not be empty.
+        ///
+        const ObstacleRecord& GetBack() const noexcept;
+        
+        /// Removes the oldest record. The record must already have been killed.
+        ///
+        void PopFront() noexcept;
+        
+        /// @param handle
+        ///     Handle to resolve
+        ///
+        /// @return The live record for the handle, or null if it has been culled or destroyed
+        ///
+        ObstacleRecord* TryGet(const ObstacleHandle& handle) noexcept;
+        
+        /// Marks a record as dead and releases its handle. The slot is reclaimed when it reaches the front.
+        ///
+        /// @param record
+        ///     Live record to kill
+        ///
+        void Kill(ObstacleRecord& record) noexcept;
+        
+        /// @param index
+        ///     Position from the front, less than GetCount()
+        ///
+        /// @return The record at that position, alive or dead
+        ///
+        ObstacleRecord& GetAt(u32 index) noexcept;
+        
+        /// @param index
+        ///     Position from the front, less than GetCount()
+        ///
+        /// @return The record at that position, alive or dead
+        ///
+        const ObstacleRecord& GetAt(u32 index) const noexcept;
+        
+        /// Binary searches the records, which are held left to right, for the first whose
+        /// bounds extend past the given x. Dead records keep their bounds so take part too.
+        ///
+        /// @param x
+        ///     Position in the same space as the record bounds
+        ///
+        /// @return Position from the front of the first record whose right edge is beyond x,
+        ///     or GetCount() if there is none
+        ///
+        u32 FindFirstEndingAfter(f32 x) const noexcept;
+        
+        /// Finds the leftmost live record overlapping the box. Only the records between the box
+        /// edges are visited.
+        ///
+        /// @param box
+        ///     Box in the same space as the record bounds
+        ///
+        /// @return The first live record whose bounds intersect the box, or null if there is none
+        ///
+        const ObstacleRecord* FindFirstOverlap(const CS::Rectangle& box) const noexcept;
+        
+        /// @param record
+        ///     A record held in this ring
+        ///
+        /// @return Handle to the record
+        ///
+        ObstacleHandle GetHandle(const ObstacleRecord& record) const noexcept;
+        
+    private:
+        
+        std::vector<ObstacleRecord> m_slots;
+        u32 m_head = 0;
+        u32 m_count = 0;
+    };
+}
+
+#endif
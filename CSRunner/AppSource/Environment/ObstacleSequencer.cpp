@@ -0,0 +1,167 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Environment/ObstacleSequencer.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <Environment/ObstacleCatalogue.h>
+#include <GameConfig.h>
+
+#include <algorithm>
+
+namespace CSRunner
+{
+    //------------------------------------------------------------
+    ObstacleSequencerSPtr ObstacleSequencer::Create(u32 seed, const ObstacleCatalogue& catalogue, const ObstaclePatternLibraryCSPtr& patterns, const DifficultyConfig& config, RefillMode refillMode) noexcept
+    {
+        ObstacleSequencerSPtr sequencer(new ObstacleSequencer(seed, catalogue, patterns, config, refillMode));
+        sequencer->Fill();
+        return sequencer;
+    }
+    
+    //------------------------------------------------------------
+    ObstacleSequencer::ObstacleSequencer(u32 seed, const ObstacleCatalogue& catalogue, const ObstaclePatternLibraryCSPtr& patterns, const DifficultyConfig& config, RefillMode refillMode) noexcept
+    : m_random(seed), m_config(config), m_refillMode(refillMode), m_minGap(std::max(config.m_minDistanceBetweenObstacles, catalogue.GetMaxCollisionWidth())), m_numLowObstacles(catalogue.GetNumObstacles(ObstacleType::k_low)), m_numHighObstacles(catalogue.GetNumObstacles(ObstacleType::k_high)), m_patterns(patterns)
+    {
+        CS_ASSERT(m_numLowObstacles > 0 && m_numHighObstacles > 0, "Sequencer requires at least one obstacle of each type.");
+        
+        if(m_patterns != nullptr && m_patterns->GetLoadState() != CS::Resource::LoadState::k_loaded)
+        {
+            m_patterns.reset();
+        }
+        
+        //Resolve the library's obstacle names once so that streaming a pattern is pure indexing
+        if(m_patterns != nullptr)
+        {
+            m_patternObstacles.resize(m_patterns->GetNumObstacleNames());
+            for(u32 i = 0; i < u32(m_patternObstacles.size()); ++i)
+            {
+                if(catalogue.FindObstacle(m_patterns->GetObstacleName(i), m_patternObstacles[i].m_type, m_patternObstacles[i].m_catalogueIndex) == false)
+                {
+                    CS_LOG_ERROR("Obstacle pattern library uses unknown obstacle '" + m_patterns->GetObstacleName(i) + "'. Patterns are disabled.");
+                    m_patterns.reset();
+                    m_patternObstacles.clear();
+                    break;
+                }
+            }
+        }
+    }
+    
+    //------------------------------------------------------------
+    bool ObstacleSequencer::TryPop(PlannedObstacle& out_obstacle) noexcept
+    {
+        if(m_refillMode == RefillMode::k_inline)
+        {
+            if(m_queue.GetSize() == 0)
+            {
+                Fill();
+            }
+            return m_queue.TryPop(out_obstacle);
+        }
+        
+        bool popped = m_queue.TryPop(out_obstacle);
+        
+        if(m_queue.GetSize() <= k_lookahead / 2 && m_refillInFlight.exchange(true) == false)
+        {
+            auto sequencer = shared_from_this();
+            CS::Application::Get()->GetTaskScheduler()->ScheduleTask(CS::TaskType::k_small, [sequencer](const CS::TaskContext&) noexcept
+            {
+                sequencer->Fill();
+                sequencer->m_refillInFlight = false;
+            });
+        }
+        
+        return popped;
+    }
+    
+    //------------------------------------------------------------
+    PlannedObstacle ObstacleSequencer::Generate() noexcept
+    {
+        ++m_numGenerated;
+        
+        if(m_patternPosition >= u32(m_pattern.size()))
+        {
+            TryStartPattern();
+        }
+        
+        if(m_patternPosition < u32(m_pattern.size()))
+        {
+            const auto& entry = m_pattern[m_patternPosition++];
+            
+            //Authored gaps are clamped so that obstacles can never overlap
+            PlannedObstacle obstacle = m_patternObstacles[entry.m_obstacle];
+            obstacle.m_gap = std::max(entry.m_gap, m_minGap);
+            return obstacle;
+        }
+        
+        PlannedObstacle obstacle;
+        
+        //Decide whether to spawn a low or high object and then randomly pick an object
+        f32 totalProbability = m_config.m_lowObstacleProbability + m_config.m_highObstacleProbability;
+        obstacle.m_type = NextUnit() * totalProbability < m_config.m_lowObstacleProbability ? ObstacleType::k_low : ObstacleType::k_high;
+        
+        u32 numOfType = obstacle.m_type == ObstacleType::k_low ? m_numLowObstacles : m_numHighObstacles;
+        obstacle.m_catalogueIndex = m_random() % numOfType;
+        
+        obstacle.m_gap = std::max(m_config.m_minDistanceBetweenObstacles * 2.0f + NextUnit() * (m_config.m_maxDistanceBetweenObstacles - m_config.m_minDistanceBetweenObstacles), m_minGap);
+        
+        return obstacle;
+    }
+    
+    //------------------------------------------------------------
+    void ObstacleSequencer::TryStartPattern() noexcept
+    {
+        if(m_patterns == nullptr || m_patterns->GetNumDifficulties() == 0 || NextUnit() >= GameConfig::k_patternProbability)
+        {
+            return;
+        }
+        
+        u32 difficulty = std::min(m_numGenerated / GameConfig::k_obstaclesPerDifficulty, m_patterns->GetNumDifficulties() - 1);
+        u32 numPatterns = m_patterns->GetNumPatterns(difficulty);
+        if(numPatterns > 0)
+        {
+            m_pattern = m_patterns->GetPattern(difficulty, m_random() % numPatterns);
+            m_patternPosition = 0;
+        }
+    }
+    
+    //------------------------------------------------------------
+    void ObstacleSequencer::Fill() noexcept
+    {
+        while(m_queue.IsFull() == false)
+        {
+            m_queue.TryPush(Generate());
+        }
+    }
+    
+    //------------------------------------------------------------
+    f32 ObstacleSequencer::NextUnit() noexcept
+    {
+        //Top 24 bits fill an f32 mantissa exactly
+        return f32(m_random() >> 8) * (1.0f / 16777216.0f);
+    }
+}
@@ -0,0 +1,146 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ENVIRONMENT_OBSTACLESEQUENCER_H_
+#define _APPSOURCE_ENVIRONMENT_OBSTACLESEQUENCER_H_
+
+#include <ForwardDeclarations.h>
+
+#include <Common/ArrayView.h>
+#include <Common/SpscQueue.h>
+#include <Environment/ObstaclePatternLibrary.h>
+#include <Environment/ObstacleRing.h>
+#include <GameConfig.h>
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace CSRunner
+{
+    /// The next obstacle to spawn, decided ahead of time
+    ///
+    struct PlannedObstacle final
+    {
+        ObstacleType m_type = ObstacleType::k_low;
+        /// Index into the catalogue's obstacles of this type
+        u32 m_catalogueIndex = 0;
+        /// Distance from the previous obstacle's origin
+        f32 m_gap = 0.0f;
+    };
+    
+    /// Decides the upcoming obstacle stream from a seed, mixing random obstacles with authored
+    /// patterns whose difficulty rises as the run goes on. Obstacles are generated on a
+    /// background task into a lock-free queue, kept topped up well ahead of the spawner,
+    /// so the main thread only dequeues. Generation is sequential from a single seeded
+    /// engine so the same seed always produces the same stream, however the refills are
+    /// timed.
+    ///
+    /// Held by shared pointer so that an in-flight refill keeps the sequencer alive if
+    /// the level is torn down first.
+    ///
+    class ObstacleSequencer final : public std::enable_shared_from_this<ObstacleSequencer>
+    {
+    public:
+        
+        /// How the queue is topped up as it is drained
+        ///
+        enum class RefillMode
+        {
+            k_background,
+            k_inline
+        };
+        
+        /// @param seed
+        ///     Seed for the obstacle stream
+        /// @param catalogue
+        ///     Catalogue the obstacles are picked from
+        /// @param patterns
+        ///     Authored patterns to mix in. May be null, in which case every obstacle is random.
+        /// @param config
+        ///     Gaps and type probabilities
+        /// @param refillMode
+        ///     Background refills keep generation off the calling thread. Inline refills run on
+        ///     the calling thread when the queue empties, for simulations that are already off
+        ///     the main thread and must never miss an obstacle.
+        ///
+        /// @return New sequencer with its queue already filled
+        ///
+        static ObstacleSequencerSPtr Create(u32 seed, const ObstacleCatalogue& catalogue, const ObstaclePatternLibraryCSPtr& patterns, const DifficultyConfig& config, RefillMode refillMode) noexcept;
+        
+        /// Consumer thread only. Refills the queue once it runs low, as set by the refill mode.
+        ///
+        /// @param out_obstacle
+        ///     Receives the next obstacle
+        ///
+        /// @return FALSE if a background refill has fallen behind and nothing is queued
+        ///
+        bool TryPop(PlannedObstacle& out_obstacle) noexcept;
+        
+    private:
+        
+        ///
+        ObstacleSequencer(u32 seed, const ObstacleCatalogue& catalogue, const ObstaclePatternLibraryCSPtr& patterns, const DifficultyConfig& config, RefillMode refillMode) noexcept;
+        
+        /// @return The next obstacle in the stream
+        ///
+        PlannedObstacle Generate() noexcept;
+        
+        /// Possibly starts an authored pattern at the current difficulty
+        ///
+        void TryStartPattern() noexcept;
+        
+        /// Generates until the queue is full. Only ever run by one thread at a time.
+        ///
+        void Fill() noexcept;
+        
+        /// @return Uniform value in [0, 1). Mapped by hand rather than with a standard
+        ///     distribution, whose output differs between standard libraries.
+        ///
+        f32 NextUnit() noexcept;
+        
+        static constexpr u32 k_lookahead = 16;
+        
+        std::mt19937 m_random;
+        DifficultyConfig m_config;
+        RefillMode m_refillMode;
+        /// Smallest gap that keeps obstacles from overlapping
+        f32 m_minGap;
+        u32 m_numLowObstacles;
+        u32 m_numHighObstacles;
+        u32 m_numGenerated = 0;
+        
+        ObstaclePatternLibraryCSPtr m_patterns;
+        /// Catalogue entry for each obstacle name in the pattern library
+        std::vector<PlannedObstacle> m_patternObstacles;
+        ArrayView<ObstaclePatternEntry> m_pattern;
+        u32 m_patternPosition = 0;
+        
+        SpscQueue<PlannedObstacle, k_lookahead> m_queue;
+        std::atomic<bool> m_refillInFlight{false};
+    };
+}
+
+#endif
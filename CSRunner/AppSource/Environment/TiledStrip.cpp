@@ -0,0 +1,158 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Environment/TiledStrip.h>
+
+#include <ChilliSource/Core/Entity.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Rendering/Base.h>
+#include <ChilliSource/Rendering/Model.h>
+#include <ChilliSource/Rendering/Texture.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace CSRunner
+{
+    namespace
+    {
+        /// Matches the layout of CS::VertexFormat::k_sprite
+        ///
+        struct StripVertex final
+        {
+            CS::Vector4 m_position;
+            CS::Vector2 m_uv;
+            CS::ByteColour m_colour;
+        };
+        
+        /// Writes the two triangles for a single tile
+        ///
+        void AddQuad(const CS::Vector2& bottomLeft, const CS::Vector2& topRight, const CS::UVs& uvs, bool flippedVertically, const CS::ByteColour& colour, std::vector<StripVertex>& vertices, std::vector<u16>& indices) noexcept
+        {
+            f32 topV = flippedVertically == false ? uvs.m_v : uvs.m_v + uvs.m_t;
+            f32 bottomV = flippedVertically == false ? uvs.m_v + uvs.m_t : uvs.m_v;
+            
+            u16 first = u16(vertices.size());
+            vertices.push_back({CS::Vector4(bottomLeft.x, topRight.y, 0.0f, 1.0f), CS::Vector2(uvs.m_u, topV), colour});
+            vertices.push_back({CS::Vector4(bottomLeft.x, bottomLeft.y, 0.0f, 1.0f), CS::Vector2(uvs.m_u, bottomV), colour});
+            vertices.push_back({CS::Vector4(topRight.x, topRight.y, 0.0f, 1.0f), CS::Vector2(uvs.m_u + uvs.m_s, topV), colour});
+            vertices.push_back({CS::Vector4(topRight.x, bottomLeft.y, 0.0f, 1.0f), CS::Vector2(uvs.m_u + uvs.m_s, bottomV), colour});
+            
+            indices.insert(indices.end(), {first, u16(first + 1), u16(first + 2), u16(first + 1), u16(first + 3), u16(first + 2)});
+        }
+    }
+    
+    //------------------------------------------------------------
+    TiledStrip::TiledStrip(const std::string& name, const CS::MaterialCSPtr& material, const CS::TextureAtlasCSPtr& atlas, const std::vector<std::string>& frameIds, f32 minLength,
+                           const CS::Colour& colour, bool flippedVertically) noexcept
+    {
+        CS_ASSERT(frameIds.empty() == false, "Tiled strip needs at least one frame.");
+        
+        for(const auto& frameId : frameIds)
+        {
+            auto size = atlas->GetOriginalFrameSize(frameId);
+            m_patternLength += size.x;
+            m_height = std::max(m_height, size.y);
+        }
+        
+        //The strip is offset by up to one pattern length while scrolling so it needs that much extra to stay covered
+        auto byteColour = CS::Colour::ColourToByteColour(colour);
+        std::vector<StripVertex> vertices;
+        std::vector<u16> indices;
+        f32 length = 0.0f;
+        while(length < minLength + m_patternLength)
+        {
+            const auto& frameId = frameIds[m_numTiles % frameIds.size()];
+            auto originalSize = atlas->GetOriginalFrameSize(frameId);
+            auto frameSize = atlas->GetFrameSize(frameId);
+            auto frameOffset = atlas->GetFrameOffset(frameId);
+            
+            //Atlas offsets are measured down from the top left of the untrimmed frame
+            f32 left = length + frameOffset.x;
+            f32 top = originalSize.y * 0.5f - frameOffset.y;
+            CS::Vector2 bottomLeft(left, top - frameSize.y);
+            CS::Vector2 topRight(left + frameSize.x, top);
+            if(flippedVertically == true)
+            {
+                std::swap(bottomLeft.y, topRight.y);
+                bottomLeft.y = -bottomLeft.y;
+                topRight.y = -topRight.y;
+            }
+            
+            AddQuad(bottomLeft, topRight, atlas->GetFrameUVs(frameId), flippedVertically, byteColour, vertices, indices);
+            
+            length += originalSize.x;
+            ++m_numTiles;
+        }
+        
+        CS_ASSERT(vertices.size() <= std::numeric_limits<u16>::max(), "Tiled strip has too many tiles for 16-bit indices.");
+        
+        auto resourcePool = CS::Application::Get()->GetResourcePool();
+        auto model = resourcePool->GetResource<CS::Model>(name);
+        if(model == nullptr)
+        {
+            CS::Vector3 centre(length * 0.5f, 0.0f, 0.0f);
+            CS::Vector3 size(length, m_height, 0.0f);
+            CS::AABB aabb(centre, size);
+            CS::Sphere boundingSphere(centre, size.Length() * 0.5f);
+            
+            u32 vertexDataSize = u32(vertices.size() * sizeof(StripVertex));
+            u8* vertexData = new u8[vertexDataSize];
+            memcpy(vertexData, vertices.data(), vertexDataSize);
+            
+            u32 indexDataSize = u32(indices.size() * sizeof(u16));
+            u8* indexData = new u8[indexDataSize];
+            memcpy(indexData, indices.data(), indexDataSize);
+            
+            std::vector<CS::MeshDesc> meshDescs;
+            meshDescs.push_back(CS::MeshDesc(name, CS::PolygonType::k_triangle, CS::VertexFormat::k_sprite, CS::IndexFormat::k_short, aabb, boundingSphere,
+                                             u32(vertices.size()), u32(indices.size()), std::unique_ptr<const u8[]>(vertexData), std::unique_ptr<const u8[]>(indexData)));
+            
+            auto mutableModel = resourcePool->CreateResource<CS::Model>(name);
+            mutableModel->Build(CS::ModelDesc(std::move(meshDescs), aabb, boundingSphere, false));
+            mutableModel->SetLoadState(CS::Resource::LoadState::k_loaded);
+            model = mutableModel;
+        }
+        
+        m_entity = CS::Entity::Create();
+        m_entity->AddComponent(std::make_shared<CS::StaticModelComponent>(model, material));
+    }
+    
+    //------------------------------------------------------------
+    void TiledStrip::SetRestPosition(const CS::Vector3& position) noexcept
+    {
+        m_restPosition = position;
+        m_entity->GetTransform().SetPosition(m_restPosition);
+    }
+    
+    //------------------------------------------------------------
+    void TiledStrip::ScrollBy(f32 distance) noexcept
+    {
+        //fmod keeps the sign of the scroll so the offset is always in (-patternLength, 0] when scrolling left
+        m_offset = std::fmod(m_offset + distance, m_patternLength);
+        m_entity->GetTransform().SetPosition(m_restPosition.x + m_offset, m_restPosition.y, m_restPosition.z);
+    }
+}
@@ -0,0 +1,102 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_ENVIRONMENT_TILEDSTRIP_H_
+#define _APPSOURCE_ENVIRONMENT_TILEDSTRIP_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Math.h>
+
+#include <string>
+#include <vector>
+
+namespace CSRunner
+{
+    /// A horizontally repeating row of atlas frames drawn as a single entity. The quads for every
+    /// tile are built once into one model, so the whole layer costs one transform and one draw
+    /// however many tiles it spans. Scrolling offsets the entity by the scroll distance wrapped
+    /// to the length of the repeating pattern, which keeps the visible tiles seamless without
+    /// ever recycling them.
+    ///
+    class TiledStrip final
+    {
+    public:
+        
+        /// @param name
+        ///     Unique resource id of the built model
+        /// @param material
+        ///     Material to render with. Must use the atlas texture.
+        /// @param atlas
+        ///     Atlas holding the frames
+        /// @param frameIds
+        ///     Frames in the order they repeat along the strip
+        /// @param minLength
+        ///     Visible length the strip must cover at every scroll offset
+        /// @param colour
+        ///     Tint baked into the vertices
+        /// @param flippedVertically
+        ///     Whether the frames are mirrored top to bottom
+        ///
+        TiledStrip(const std::string& name, const CS::MaterialCSPtr& material, const CS::TextureAtlasCSPtr& atlas, const std::vector<std::string>& frameIds, f32 minLength,
+                   const CS::Colour& colour = CS::Colour::k_white, bool flippedVertically = false) noexcept;
+        
+        /// @return Entity drawing the strip. Its origin is the vertical centre of the left edge of the first tile.
+        ///
+        const CS::EntitySPtr& GetEntity() const noexcept { return m_entity; }
+        
+        /// @return Height of the tallest frame
+        ///
+        f32 GetHeight() const noexcept { return m_height; }
+        
+        /// @return Number of tiles built into the strip
+        ///
+        u32 GetNumTiles() const noexcept { return m_numTiles; }
+        
+        /// @param position
+        ///     Where the strip origin sits when unscrolled
+        ///
+        void SetRestPosition(const CS::Vector3& position) noexcept;
+        
+        /// Scrolls the strip, wrapping its offset from the rest position to the length of
+        /// the repeating pattern
+        ///
+        /// @param distance
+        ///     Distance to scroll, negative when scrolling left
+        ///
+        void ScrollBy(f32 distance) noexcept;
+        
+    private:
+        
+        CS::EntitySPtr m_entity;
+        CS::Vector3 m_restPosition;
+        f32 m_offset = 0.0f;
+        f32 m_height = 0.0f;
+        f32 m_patternLength = 0.0f;
+        u32 m_numTiles = 0;
+    };
+}
+
+#endif
@@ -31,8 +31,30 @@ namespace CSRunner
 {
     CS_FORWARDDECLARE_CLASS(CollisionSystem);
     CS_FORWARDDECLARE_CLASS(LevelGeneratorSystem);
-    CS_FORWARDDECLARE_CLASS(KeyframeAnimation);
+    CS_FORWARDDECLARE_CLASS(LevelStream);
+    CS_FORWARDDECLARE_CLASS(AnimationClip);
+    CS_FORWARDDECLARE_CLASS(AnimationClipTable);
+    CS_FORWARDDECLARE_CLASS(AnimationClipTableProvider);
+    CS_FORWARDDECLARE_CLASS(AnimationSystem);
+    CS_FORWARDDECLARE_CLASS(ObstacleCatalogue);
+    CS_FORWARDDECLARE_STRUCT(ObstacleDesc);
+    CS_FORWARDDECLARE_CLASS(ObstaclePatternLibrary);
+    CS_FORWARDDECLARE_CLASS(ObstaclePatternLibraryProvider);
+    CS_FORWARDDECLARE_CLASS(ObstacleRing);
+    CS_FORWARDDECLARE_CLASS(ObstacleSequencer);
+    CS_FORWARDDECLARE_STRUCT(PlannedObstacle);
+    CS_FORWARDDECLARE_STRUCT(ObstacleHandle);
+    CS_FORWARDDECLARE_CLASS(TiledStrip);
+    CS_FORWARDDECLARE_CLASS(EasingCurve);
+    CS_FORWARDDECLARE_CLASS(TweenSystem);
+    CS_FORWARDDECLARE_CLASS(TextBinding);
+    CS_FORWARDDECLARE_CLASS(AutoPlayer);
+    CS_FORWARDDECLARE_CLASS(GhostRun);
     CS_FORWARDDECLARE_CLASS(PlayerController);
+    CS_FORWARDDECLARE_CLASS(PlayerInputQueue);
+    CS_FORWARDDECLARE_CLASS(PlayerMotion);
+    CS_FORWARDDECLARE_CLASS(RunSimulation);
+    CS_FORWARDDECLARE_STRUCT(DifficultyConfig);
     CS_FORWARDDECLARE_CLASS(TransitionSystem);
 }
 
@@ -53,6 +53,8 @@ namespace CSRunner
         constexpr f32 k_maxDistanceBetweenObstacles = k_levelWidth * 1.5f;
         constexpr f32 k_lowObstacleProbability = 2.0f;
         constexpr f32 k_highObstacleProbability = 1.0f;
+        constexpr f32 k_patternProbability = 0.3f;
+        constexpr u32 k_obstaclesPerDifficulty = 20;
         constexpr f32 k_startingX = 0.0f;
         
         constexpr f32 k_cullX = -k_levelWidth * 0.5f;
@@ -62,6 +64,18 @@ namespace CSRunner
         constexpr f32 k_playerSlideHeight = k_playerHeight * 0.5f;
         constexpr f32 k_ceilingY = k_groundY + k_highObstacleSpawnOffset + 420.0f;
     }
+    
+    /// The difficulty settings as a runtime struct so that they can be varied without a rebuild,
+    /// such as by the difficulty sweep. Defaults to the constants above.
+    ///
+    struct DifficultyConfig final
+    {
+        f32 m_scrollSpeed = GameConfig::k_scrollSpeed;
+        f32 m_minDistanceBetweenObstacles = GameConfig::k_minDistanceBetweenObstacles;
+        f32 m_maxDistanceBetweenObstacles = GameConfig::k_maxDistanceBetweenObstacles;
+        f32 m_lowObstacleProbability = GameConfig::k_lowObstacleProbability;
+        f32 m_highObstacleProbability = GameConfig::k_highObstacleProbability;
+    };
 }
 
 #endif
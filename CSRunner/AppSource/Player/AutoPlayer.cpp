@@ -0,0 +1,95 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Player/AutoPlayer.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Math.h>
+
+#include <Environment/LevelGeneratorSystem.h>
+#include <Player/PlayerController.h>
+#include <GameConfig.h>
+
+namespace CSRunner
+{
+    namespace
+    {
+        /// How long before an obstacle reaches the player the bot reacts to it
+        ///
+        constexpr f32 k_reactionTime = 0.1f;
+    }
+    
+    //------------------------------------------------------------
+    AutoPlayer::Action AutoPlayer::Decide(const ObstacleRing& obstacles, const CS::Rectangle& playerBox, f32 scrollSpeed) noexcept
+    {
+        f32 playerLeft = playerBox.vOrigin.x - playerBox.vSize.x * 0.5f;
+        f32 playerRight = playerBox.vOrigin.x + playerBox.vSize.x * 0.5f;
+        
+        for(u32 i = obstacles.FindFirstEndingAfter(playerLeft); i < obstacles.GetCount(); ++i)
+        {
+            const auto& obstacle = obstacles.GetAt(i);
+            if(obstacle.m_alive == false)
+            {
+                continue;
+            }
+            
+            f32 distance = obstacle.m_bounds.vOrigin.x - obstacle.m_bounds.vSize.x * 0.5f - playerRight;
+            if(distance > scrollSpeed * k_reactionTime)
+            {
+                return Action::k_none;
+            }
+            
+            return obstacle.m_type == ObstacleType::k_low ? Action::k_jump : Action::k_slide;
+        }
+        
+        return Action::k_none;
+    }
+    
+    //------------------------------------------------------------
+    AutoPlayer::AutoPlayer(const LevelGeneratorSystem* levelGenerator, PlayerController* playerController) noexcept
+    : m_levelGenerator(levelGenerator), m_playerController(playerController)
+    {
+        CS_ASSERT(m_levelGenerator != nullptr && m_playerController != nullptr, "Auto player requires a level and a player.");
+    }
+    
+    //------------------------------------------------------------
+    void AutoPlayer::Update() noexcept
+    {
+        //Work in the world-local space the obstacle bounds are held in
+        CS::Rectangle playerBox = m_playerController->GetWorldCollisionBox();
+        playerBox.vOrigin.x -= m_levelGenerator->GetStream().GetScrollX();
+        
+        switch(Decide(m_levelGenerator->GetStream().GetObstacles(), playerBox, m_levelGenerator->GetConfig().m_scrollSpeed))
+        {
+            case Action::k_jump:
+                m_playerController->Jump();
+                break;
+            case Action::k_slide:
+                m_playerController->Slide();
+                break;
+            case Action::k_none:
+                break;
+        }
+    }
+}
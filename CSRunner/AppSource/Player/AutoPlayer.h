@@ -0,0 +1,83 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_PLAYER_AUTOPLAYER_H_
+#define _APPSOURCE_PLAYER_AUTOPLAYER_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Math.h>
+
+namespace CSRunner
+{
+    /// Scripted bot that plays the game in place of input. Looks at the next live obstacle
+    /// ahead of the player and jumps low obstacles or slides under high ones once it is
+    /// within reaction distance.
+    ///
+    class AutoPlayer final
+    {
+    public:
+        
+        /// What the bot wants the player to do
+        ///
+        enum class Action
+        {
+            k_none,
+            k_jump,
+            k_slide
+        };
+        
+        /// Decides on an action without touching any entities, so that it can be shared with
+        /// simulations that run outside of the scene.
+        ///
+        /// @param obstacles
+        ///     Upcoming obstacles in world-local space
+        /// @param playerBox
+        ///     Player collision box in the same space as the obstacles
+        /// @param scrollSpeed
+        ///     Speed the obstacles approach at. The bot reacts a fixed time ahead of them.
+        ///
+        /// @return Action to issue this step
+        ///
+        static Action Decide(const ObstacleRing& obstacles, const CS::Rectangle& playerBox, f32 scrollSpeed) noexcept;
+        
+        /// @param levelGenerator
+        ///     Source of the upcoming obstacles
+        /// @param playerController
+        ///     Player to drive
+        ///
+        AutoPlayer(const LevelGeneratorSystem* levelGenerator, PlayerController* playerController) noexcept;
+        
+        /// Decides on and issues any action for this step
+        ///
+        void Update() noexcept;
+        
+    private:
+        
+        const LevelGeneratorSystem* m_levelGenerator;
+        PlayerController* m_playerController;
+    };
+}
+
+#endif
@@ -0,0 +1,154 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Player/GhostRun.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CSRunner
+{
+    namespace
+    {
+        constexpr u32 k_fileId = 0x48475343; //"CSGH"
+        constexpr u32 k_version = 1;
+        constexpr u32 k_headerSize = 5 * sizeof(u32);
+        
+        constexpr u32 k_actionShift = 14;
+        constexpr u16 k_maxDeltaMs = (1 << k_actionShift) - 1;
+        constexpr u16 k_waitCode = 3;
+        
+        /// @param seconds
+        ///     Time in seconds
+        ///
+        /// @return Time in whole milliseconds
+        ///
+        u32 ToMilliseconds(f32 seconds) noexcept
+        {
+            return u32(std::round(std::max(seconds, 0.0f) * 1000.0f));
+        }
+    }
+    
+    //------------------------------------------------------------
+    GhostRunUPtr GhostRun::Load(CS::StorageLocation location, const std::string& filePath) noexcept
+    {
+        auto stream = CS::Application::Get()->GetFileSystem()->CreateBinaryInputStream(location, filePath);
+        if(stream == nullptr || stream->GetLength() < k_headerSize)
+        {
+            return nullptr;
+        }
+        
+        u32 header[5];
+        stream->Read(reinterpret_cast<u8*>(header), k_headerSize);
+        
+        //The word count is checked against the size left rather than added to the header, so that no count can wrap the check
+        u64 wordsSize = u64(stream->GetLength()) - k_headerSize;
+        if(header[0] != k_fileId || header[1] != k_version || wordsSize % sizeof(u16) != 0 || wordsSize / sizeof(u16) != header[4])
+        {
+            CS_LOG_WARNING("Ignoring invalid ghost run '" + filePath + "'.");
+            return nullptr;
+        }
+        
+        GhostRunUPtr run(new GhostRun(header[2]));
+        run->m_durationMs = header[3];
+        run->m_words.resize(header[4]);
+        if(run->m_words.empty() == false)
+        {
+            stream->Read(reinterpret_cast<u8*>(run->m_words.data()), u32(run->m_words.size() * sizeof(u16)));
+        }
+        
+        return run;
+    }
+    
+    //------------------------------------------------------------
+    GhostRun::GhostRun(u32 seed) noexcept
+    : m_seed(seed)
+    {
+    }
+    
+    //------------------------------------------------------------
+    void GhostRun::SetDuration(f32 duration) noexcept
+    {
+        m_durationMs = ToMilliseconds(duration);
+    }
+    
+    //------------------------------------------------------------
+    void GhostRun::Record(PlayerAction action, f32 time) noexcept
+    {
+        u32 timeMs = std::max(ToMilliseconds(time), m_lastTimeMs);
+        u32 deltaMs = timeMs - m_lastTimeMs;
+        
+        while(deltaMs > k_maxDeltaMs)
+        {
+            m_words.push_back(u16(k_waitCode << k_actionShift) | k_maxDeltaMs);
+            deltaMs -= k_maxDeltaMs;
+        }
+        
+        m_words.push_back(u16(u16(action) << k_actionShift) | u16(deltaMs));
+        m_lastTimeMs = timeMs;
+    }
+    
+    //------------------------------------------------------------
+    bool GhostRun::ReadNext(Cursor& cursor, PlayerAction& out_action, f32& out_time) const noexcept
+    {
+        while(cursor.m_wordIndex < u32(m_words.size()))
+        {
+            u16 word = m_words[cursor.m_wordIndex++];
+            u16 code = word >> k_actionShift;
+            cursor.m_timeMs += word & k_maxDeltaMs;
+            
+            if(code != k_waitCode)
+            {
+                out_action = PlayerAction(code);
+                out_time = f32(cursor.m_timeMs) / 1000.0f;
+                return true;
+            }
+        }
+        
+        return false;
+    }
+    
+    //------------------------------------------------------------
+    bool GhostRun::Save(CS::StorageLocation location, const std::string& filePath) const noexcept
+    {
+        auto stream = CS::Application::Get()->GetFileSystem()->CreateBinaryOutputStream(location, filePath);
+        if(stream == nullptr)
+        {
+            CS_LOG_ERROR("Could not save ghost run '" + filePath + "'.");
+            return false;
+        }
+        
+        const u32 header[5] = { k_fileId, k_version, m_seed, m_durationMs, u32(m_words.size()) };
+        stream->Write(reinterpret_cast<const u8*>(header), k_headerSize);
+        if(m_words.empty() == false)
+        {
+            stream->Write(reinterpret_cast<const u8*>(m_words.data()), GetNumBytes());
+        }
+        
+        return true;
+    }
+}
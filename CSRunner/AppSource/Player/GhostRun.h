@@ -0,0 +1,132 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_PLAYER_GHOSTRUN_H_
+#define _APPSOURCE_PLAYER_GHOSTRUN_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/File.h>
+
+#include <Player/PlayerMotion.h>
+
+#include <vector>
+
+namespace CSRunner
+{
+    /// A recorded run that a ghost can replay: the level seed and every action the player
+    /// performed, with the time it was performed at. Only actions that changed the player's
+    /// state are recorded, so replaying them through a PlayerMotion re-evaluates the same tweens.
+    ///
+    /// Each action is one 16 bit word: the top 2 bits hold the action and the remaining 14 hold
+    /// the milliseconds since the previous word. Longer pauses are bridged with wait words, so a
+    /// minute of play costs 2 bytes per action plus at most 8 bytes of waits.
+    ///
+    /// Saved as "CSGH" version 1: file id, version, seed, duration in ms and word count as u32,
+    /// followed by the words.
+    ///
+    class GhostRun final
+    {
+    public:
+        
+        /// Position of a reader within the recorded actions
+        ///
+        struct Cursor final
+        {
+            u32 m_wordIndex = 0;
+            u32 m_timeMs = 0;
+        };
+        
+        /// @param location
+        ///     Storage location
+        /// @param filePath
+        ///     File path
+        ///
+        /// @return The saved run, or null if there isn't a valid one
+        ///
+        static GhostRunUPtr Load(CS::StorageLocation location, const std::string& filePath) noexcept;
+        
+        /// @param seed
+        ///     Seed of the level being recorded
+        ///
+        GhostRun(u32 seed) noexcept;
+        
+        /// @return Seed of the level the run was recorded on
+        ///
+        u32 GetSeed() const noexcept { return m_seed; }
+        
+        /// @return Length of the run in seconds
+        ///
+        f32 GetDuration() const noexcept { return f32(m_durationMs) / 1000.0f; }
+        
+        /// @param duration
+        ///     Length of the run in seconds
+        ///
+        void SetDuration(f32 duration) noexcept;
+        
+        /// @return Size of the recorded actions in bytes
+        ///
+        u32 GetNumBytes() const noexcept { return u32(m_words.size() * sizeof(u16)); }
+        
+        /// Appends an action. Actions must be recorded in time order.
+        ///
+        /// @param action
+        ///     Action performed
+        /// @param time
+        ///     Seconds since the start of the run
+        ///
+        void Record(PlayerAction action, f32 time) noexcept;
+        
+        /// Reads the next action and advances the cursor past it
+        ///
+        /// @param cursor
+        ///     Position to read from
+        /// @param out_action
+        ///     Action performed
+        /// @param out_time
+        ///     Seconds since the start of the run
+        ///
+        /// @return FALSE if there are no more actions
+        ///
+        bool ReadNext(Cursor& cursor, PlayerAction& out_action, f32& out_time) const noexcept;
+        
+        /// @param location
+        ///     Storage location
+        /// @param filePath
+        ///     File path
+        ///
+        /// @return Whether the run was saved
+        ///
+        bool Save(CS::StorageLocation location, const std::string& filePath) const noexcept;
+        
+    private:
+        
+        u32 m_seed;
+        u32 m_durationMs = 0;
+        u32 m_lastTimeMs = 0;
+        std::vector<u16> m_words;
+    };
+}
+
+#endif
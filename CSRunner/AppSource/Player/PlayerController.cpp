@@ -27,32 +27,39 @@
 #include <ChilliSource/Audio/CricketAudio.h>
 #include <ChilliSource/Rendering/Sprite.h>
 
-#include <GameConfig.h>
+#include <Animation/AnimationClipTable.h>
+#include <Animation/AnimationSystem.h>
+
+#include <algorithm>
 
 namespace CSRunner
 {
     CS_DEFINE_NAMEDTYPE(PlayerController);
     
     //------------------------------------------------------------
-    PlayerController::PlayerController(CS::SpriteComponent* spriteComponent) noexcept
+    PlayerController::PlayerController(CS::SpriteComponent* spriteComponent, AnimationSystem* animationSystem, const AnimationClipTableCSPtr& clipTable) noexcept
     :
     m_spriteComponent(spriteComponent),
-    m_runningAnimation(spriteComponent, {"Run_01","Run_02","Run_03","Run_04","Run_05","Run_06","Run_07","Run_08","Run_09"}),
-    m_jumpingAnimation(spriteComponent, {"Jump_01"}),
-    m_bombingAnimation(spriteComponent, {"Jump_01"}),
-    m_slidingAnimation(spriteComponent, {"Slide_01"}),
-    m_collidingAnimation(spriteComponent, {"Collide_01","Collide_02","Collide_03","Collide_04","Collide_05","Collide_06","Collide_07","Collide_08","Collide_09"})
+    m_clipTable(clipTable),
+    m_runningClip(clipTable->GetClip("Run")),
+    m_jumpingClip(clipTable->GetClip("Jump")),
+    m_slidingClip(clipTable->GetClip("Slide")),
+    m_collidingClip(clipTable->GetClip("Collide")),
+    m_animationSystem(animationSystem)
     {
+        CS_ASSERT(m_runningClip != nullptr && m_jumpingClip != nullptr && m_slidingClip != nullptr && m_collidingClip != nullptr, "Player clip table is missing clips.");
+        
+        m_animationId = m_animationSystem->Add(m_spriteComponent);
+        m_animationSystem->Play(m_animationId, m_runningClip, AnimationSystem::PlayMode::k_looping);
+        
         //Align the player on the ground
         m_spriteComponent->SetOriginAlignment(CS::AlignmentAnchor::k_bottomCentre);
-        m_localCollisionBox.vOrigin = CS::Vector2(0.0f, GameConfig::k_playerHeight * 0.5f);
-        m_localCollisionBox.vSize = CS::Vector2(GameConfig::k_playerWidth * GameConfig::k_playerWidthCollisionScale, GameConfig::k_playerHeight);
     }
     
 #ifndef CS_TARGETPLATFORM_RPI
     //------------------------------------------------------------
-    PlayerController::PlayerController(CS::SpriteComponent* spriteComponent, CS::CkAudioPlayer* audioPlayer, CS::CkBankCSPtr audioBank) noexcept
-    : PlayerController(spriteComponent)
+    PlayerController::PlayerController(CS::SpriteComponent* spriteComponent, AnimationSystem* animationSystem, const AnimationClipTableCSPtr& clipTable, CS::CkAudioPlayer* audioPlayer, CS::CkBankCSPtr audioBank) noexcept
+    : PlayerController(spriteComponent, animationSystem, clipTable)
     {
         m_audioPlayer = audioPlayer;
         m_audioBank = audioBank;
@@ -68,7 +75,7 @@ namespace CSRunner
     //------------------------------------------------------------
     CS::Rectangle PlayerController::GetWorldCollisionBox() const noexcept
     {
-        CS::Rectangle worldBox = m_localCollisionBox;
+        CS::Rectangle worldBox = m_motion.GetLocalCollisionBox();
         worldBox.vOrigin += GetEntity()->GetTransform().GetWorldPosition().XY();
         return worldBox;
     }
@@ -76,127 +83,196 @@ namespace CSRunner
     //------------------------------------------------------------
     void PlayerController::Jump() noexcept
     {
-        if(m_state == PlayerState::k_running || m_state == PlayerState::k_sliding)
+        Perform(PlayerAction::k_jump);
+    }
+    
+    //------------------------------------------------------------
+    void PlayerController::Slide() noexcept
+    {
+        Perform(PlayerAction::k_slide);
+    }
+
+    //------------------------------------------------------------
+    void PlayerController::Bump() noexcept
+    {
+        Perform(PlayerAction::k_bump);
+    }
+    
+    //------------------------------------------------------------
+    void PlayerController::Perform(PlayerAction action) noexcept
+    {
+        if(ApplyAction(action) == true)
         {
-            m_state = PlayerState::k_jumping;
-            m_localCollisionBox.vSize.y = GameConfig::k_playerHeight;
-            
-            m_jumpTween = CS::MakeEaseOutBackTween(GameConfig::k_groundY, GameConfig::k_groundY + GameConfig::k_playerJumpHeight, GameConfig::k_playerJumpDuration);
-            m_jumpTween.Play(CS::TweenPlayMode::k_pingPong);
-            
-#ifndef CS_TARGETPLATFORM_RPI
-            m_audioPlayer->PlayEffect(m_audioBank, "Jump");
-#endif
+            OnStateChanged();
         }
     }
     
     //------------------------------------------------------------
-    void PlayerController::Slide() noexcept
+    bool PlayerController::ApplyAction(PlayerAction action) noexcept
     {
-        if(m_state == PlayerState::k_running)
+        if(m_motion.Perform(action) == false)
         {
-            m_slidingTimer = 0.0f;
-            m_localCollisionBox.vSize.y = GameConfig::k_playerSlideHeight;
-            m_state = PlayerState::k_sliding;
-            
-#ifndef CS_TARGETPLATFORM_RPI
-            m_audioPlayer->PlayEffect(m_audioBank, "Slide");
-#endif
+            return false;
         }
-        else if(m_state == PlayerState::k_jumping)
+        
+        if(m_recording != nullptr)
         {
-            m_state = PlayerState::k_bombing;
-            m_localCollisionBox.vSize.y = GameConfig::k_playerHeight;
-       
-            m_bombTween = CS::MakeEaseOutBackTween(GetEntity()->GetTransform().GetLocalPosition().y, GameConfig::k_groundY, GameConfig::k_playerBombDuration);
-            m_bombTween.Play(CS::TweenPlayMode::k_once);
-            
-#ifndef CS_TARGETPLATFORM_RPI
-            m_audioPlayer->PlayEffect(m_audioBank, "Slide");
-#endif
+            m_recording->Record(action, m_elapsedTime);
         }
+        
+        return true;
     }
-
+    
     //------------------------------------------------------------
-    void PlayerController::Bump() noexcept
+    void PlayerController::QueueAction(PlayerAction action) noexcept
     {
-        if(m_state != PlayerState::k_colliding)
-        {
-            m_state = PlayerState::k_colliding;
-            m_localCollisionBox.vSize.y = GameConfig::k_playerHeight;
-       
-            CS::Vector3 pos = GetEntity()->GetTransform().GetLocalPosition();
-            m_bumpTween = CS::MakeEaseInOutQuadTween(pos, CS::Vector3(pos.x - GameConfig::k_playerBumpBackDistance, GameConfig::k_groundY, 0.0f), GameConfig::k_playerBumpDuration);
-            m_bumpTween.Play(CS::TweenPlayMode::k_once);
-            
-#ifndef CS_TARGETPLATFORM_RPI
-            m_audioPlayer->PlayEffect(m_audioBank, "Break");
-#endif
-        }
+        m_inputQueue.Push(action);
+    }
+    
+    //------------------------------------------------------------
+    void PlayerController::QueueAction(PlayerAction action, f64 gamepadTimestamp) noexcept
+    {
+        m_inputQueue.Push(action, gamepadTimestamp);
+    }
+    
+    //------------------------------------------------------------
+    void PlayerController::SetRecording(GhostRun* recording) noexcept
+    {
+        m_recording = recording;
+    }
+    
+    //------------------------------------------------------------
+    void PlayerController::SetPlayback(const GhostRun* playback) noexcept
+    {
+        m_playback = playback;
+        m_playbackCursor = GhostRun::Cursor();
+        m_hasNextPlaybackAction = m_playback != nullptr && m_playback->ReadNext(m_playbackCursor, m_nextPlaybackAction, m_nextPlaybackTime);
     }
     
     //------------------------------------------------------------
     void PlayerController::Run() noexcept
     {
-        m_state = PlayerState::k_running;
-        m_localCollisionBox.vSize.y = GameConfig::k_playerHeight;
+        m_motion.Run();
+        OnStateChanged();
     }
     
     //------------------------------------------------------------
     void PlayerController::OnUpdate(f32 timeSinceLastUpdate) noexcept
     {
-        bool transformDirty = false;
-        CS::Vector3 currentPos = GetEntity()->GetTransform().GetLocalPosition();
+        Step(timeSinceLastUpdate);
+    }
+    
+    //------------------------------------------------------------
+    void PlayerController::Step(f32 timeSinceLastUpdate) noexcept
+    {
+        bool moved = false;
         
-        if(m_state == PlayerState::k_running)
-        {
-            m_runningAnimation.Update(timeSinceLastUpdate, KeyframeAnimation::UpdateMode::k_looping);
-        }
-        else if(m_state == PlayerState::k_jumping)
+        //Apply each action at its own time within the step, rather than at the step boundary, so that the tweens
+        //start when the player acted and a ghost follows the recorded run whatever the frame rate. Every state entered
+        //along the way is presented, so that two changes in one step each play their sound and a new bump restarts
+        //the collide clip.
+        f32 startTime = m_elapsedTime;
+        f32 endTime = m_elapsedTime + timeSinceLastUpdate;
+        f64 stepTimestamp = PlayerInputQueue::GetTimestamp();
+        
+        PlayerAction action;
+        f32 actionTime = 0.0f;
+        while(TryTakeNextAction(startTime, endTime, stepTimestamp, action, actionTime) == true)
         {
-            m_jumpingAnimation.Update(timeSinceLastUpdate, KeyframeAnimation::UpdateMode::k_looping);
-            currentPos.y = m_jumpTween.Update(timeSinceLastUpdate);
-            transformDirty = true;
-            if(m_jumpTween.IsFinished() == true)
+            moved = StepMotion(actionTime) || moved;
+            if(ApplyAction(action) == true)
             {
-                Run();
+                OnStateChanged();
             }
         }
-        else if(m_state == PlayerState::k_bombing)
+        
+        moved = StepMotion(endTime) || moved;
+        m_lastStepTimestamp = stepTimestamp;
+        
+        if(moved == true)
         {
-            m_bombingAnimation.Update(timeSinceLastUpdate, KeyframeAnimation::UpdateMode::k_looping);
-            currentPos.y = m_bombTween.Update(timeSinceLastUpdate);
-            transformDirty = true;
-            if(m_bombTween.IsFinished() == true)
-            {
-                Run();
-            }
+            GetEntity()->GetTransform().SetPosition(m_motion.GetPosition());
         }
-        else if(m_state == PlayerState::k_sliding)
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerController::StepMotion(f32 time) noexcept
+    {
+        PlayerState previousState = m_motion.GetState();
+        bool moved = m_motion.Step(time - m_elapsedTime);
+        m_elapsedTime = time;
+        
+        if(m_motion.GetState() != previousState)
         {
-            m_slidingTimer += timeSinceLastUpdate;
-            m_slidingAnimation.Update(timeSinceLastUpdate, KeyframeAnimation::UpdateMode::k_looping);
-            
-            if(m_slidingTimer >= GameConfig::k_playerSlideDuration)
-            {
-                Run();
-            }
+            OnStateChanged();
         }
-        else if(m_state == PlayerState::k_colliding)
+        
+        return moved;
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerController::TryTakeNextAction(f32 stepStartTime, f32 stepEndTime, f64 stepTimestamp, PlayerAction& out_action, f32& out_time) noexcept
+    {
+        if(m_hasNextPlaybackAction == true && m_nextPlaybackTime <= stepEndTime)
+        {
+            out_action = m_nextPlaybackAction;
+            out_time = std::max(m_nextPlaybackTime, m_elapsedTime);
+            m_hasNextPlaybackAction = m_playback->ReadNext(m_playbackCursor, m_nextPlaybackAction, m_nextPlaybackTime);
+            return true;
+        }
+        
+        PlayerInputQueue::TimedAction input;
+        if(m_inputQueue.TryPop(input) == true)
         {
-            m_collidingAnimation.Update(timeSinceLastUpdate, KeyframeAnimation::UpdateMode::k_once);
-            currentPos = m_bumpTween.Update(timeSinceLastUpdate);
-            transformDirty = true;
-            if(m_bumpTween.IsFinished() == true)
+            //Input that arrived between the last step and this one is spread over this step in the same proportion.
+            //Before the first step there is no previous step to measure from, so it is applied at the end.
+            f32 fraction = 1.0f;
+            f64 wallInterval = stepTimestamp - m_lastStepTimestamp;
+            if(m_lastStepTimestamp > 0.0 && wallInterval > 0.0)
             {
-                Run();
+                fraction = std::min(std::max(f32((input.m_timestamp - m_lastStepTimestamp) / wallInterval), 0.0f), 1.0f);
             }
+            
+            out_action = input.m_action;
+            out_time = std::max(stepStartTime + (stepEndTime - stepStartTime) * fraction, m_elapsedTime);
+            return true;
         }
         
-        if(transformDirty == true)
+        return false;
+    }
+    
+    //------------------------------------------------------------
+    void PlayerController::OnStateChanged() noexcept
+    {
+        //How a state is presented. A null clip keeps the current animation and a null effect plays no sound.
+        struct StatePresentation final
+        {
+            const AnimationClip* PlayerController::* m_clip;
+            AnimationSystem::PlayMode m_playMode;
+            const char* m_effect;
+        };
+        
+        //One row per state, in declaration order. Bombing keeps the jump animation on the way down.
+        static constexpr StatePresentation k_presentations[] =
         {
-            GetEntity()->GetTransform().SetPosition(currentPos);
+            { &PlayerController::m_runningClip, AnimationSystem::PlayMode::k_looping, nullptr },
+            { &PlayerController::m_jumpingClip, AnimationSystem::PlayMode::k_looping, "Jump" },
+            { &PlayerController::m_slidingClip, AnimationSystem::PlayMode::k_looping, "Slide" },
+            { nullptr, AnimationSystem::PlayMode::k_looping, "Slide" },
+            { &PlayerController::m_collidingClip, AnimationSystem::PlayMode::k_once, "Break" }
+        };
+        
+        const StatePresentation& presentation = k_presentations[u32(m_motion.GetState())];
+        if(presentation.m_clip != nullptr)
+        {
+            m_animationSystem->Play(m_animationId, this->*presentation.m_clip, presentation.m_playMode);
         }
+        
+#ifndef CS_TARGETPLATFORM_RPI
+        if(m_audioPlayer != nullptr && presentation.m_effect != nullptr)
+        {
+            m_audioPlayer->PlayEffect(m_audioBank, presentation.m_effect);
+        }
+#endif
     }
 }
-
@@ -29,21 +29,14 @@
 
 #include <ChilliSource/Core/Entity.h>
 #include <ChilliSource/Core/Math.h>
-#include <ChilliSource/Core/Tween.h>
 
-#include <Animation/KeyframeAnimation.h>
+#include <Player/GhostRun.h>
+#include <Player/PlayerInputQueue.h>
+#include <Player/PlayerMotion.h>
+
 
 namespace CSRunner
 {
-    enum class PlayerState
-    {
-        k_running,
-        k_jumping,
-        k_sliding,
-        k_bombing,
-        k_colliding,
-    };
-    
     /// Component that controls the actions of the runner (player).
     ///
     /// Handles the player actions: run, jump, slide, bump, etc in response
@@ -51,6 +44,9 @@ namespace CSRunner
     ///
     /// NOTE: The player doesn't really move horizontally (except for bumping) instead the level moves
     ///
+    /// The state machine itself lives in PlayerMotion; this component presents it through the
+    /// entity transform, animations and audio.
+    ///
     class PlayerController final : public CS::Component
     {
     public:
@@ -59,18 +55,26 @@ namespace CSRunner
         
         /// @param spriteComponent
         ///     Used to change the animation of the player and to grab the collision box
+        /// @param animationSystem
+        ///     Plays the player's animations
+        /// @param clipTable
+        ///     Holds the player's animation clips
         ///
-        PlayerController(CS::SpriteComponent* spriteComponent) noexcept;
+        PlayerController(CS::SpriteComponent* spriteComponent, AnimationSystem* animationSystem, const AnimationClipTableCSPtr& clipTable) noexcept;
         
         /// @param spriteComponent
         ///     Used to change the animation of the player and to grab the collision box
+        /// @param animationSystem
+        ///     Plays the player's animations
+        /// @param clipTable
+        ///     Holds the player's animation clips
         /// @param audioPlayer
         ///     Used to play the player's action audio
         /// @param audioBank
         ///     Bank containing audio for the player
         ///
 #ifndef CS_TARGETPLATFORM_RPI
-        PlayerController(CS::SpriteComponent* spriteComponent, CS::CkAudioPlayer* audioPlayer, CS::CkBankCSPtr audioBank) noexcept;
+        PlayerController(CS::SpriteComponent* spriteComponent, AnimationSystem* animationSystem, const AnimationClipTableCSPtr& clipTable, CS::CkAudioPlayer* audioPlayer, CS::CkBankCSPtr audioBank) noexcept;
 #endif
         
         ///
@@ -99,12 +103,59 @@ namespace CSRunner
         ///
         void Run() noexcept;
         
+        /// Queues an action from player input. Unlike Jump and Slide, which act straight away, the
+        /// action is stamped with the time it arrived and is applied on the next step at the matching
+        /// point within the step, so the result doesn't depend on where the frame boundaries fall.
+        /// For input sources that carry no timestamp of their own.
+        ///
+        /// @param action
+        ///     Action to queue
+        ///
+        void QueueAction(PlayerAction action) noexcept;
+        
+        /// Queues an action from gamepad input, applied on the next step at the point matching
+        /// the OS timestamp of the event rather than the time the game received it
+        ///
+        /// @param action
+        ///     Action to queue
+        /// @param gamepadTimestamp
+        ///     Seconds on the gamepad clock at which the action happened
+        ///
+        void QueueAction(PlayerAction action, f64 gamepadTimestamp) noexcept;
+        
+        /// Update the state machine and process any commands. Called every frame while the
+        /// player is in a scene; a player kept out of the scene must be stepped explicitly.
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since the last step
+        ///
+        void Step(f32 timeSinceLastUpdate) noexcept;
+        
+        /// @return The player's state machine and movement
+        ///
+        const PlayerMotion& GetMotion() const noexcept { return m_motion; }
+        
+        /// Records every action that changes the player's state from now on
+        ///
+        /// @param recording
+        ///     Run to record into. Must outlive the player, or be cleared first.
+        ///
+        void SetRecording(GhostRun* recording) noexcept;
+        
+        /// Turns the player into a ghost that replays the recorded actions, each at the time
+        /// it was recorded, rather than taking actions from the game
+        ///
+        /// @param playback
+        ///     Run to replay. Must outlive the player.
+        ///
+        void SetPlayback(const GhostRun* playback) noexcept;
+        
         ///
         ~PlayerController() noexcept { }
         
     private:
         
-        /// Update the state machine and process any commands
+        /// Steps the player
         ///
         /// @param timeSinceLastUpdate
         ////    Time since last update in seconds
@@ -113,27 +164,80 @@ namespace CSRunner
         
     private:
         
-        CS::Rectangle m_localCollisionBox;
+        /// Performs the action straight away and presents any change of state
+        ///
+        /// @param action
+        ///     Action to perform
+        ///
+        void Perform(PlayerAction action) noexcept;
+        
+        /// Applies the action to the motion, recording it if it changes the state
+        ///
+        /// @param action
+        ///     Action to apply
+        ///
+        /// @return Whether the state changed
+        ///
+        bool ApplyAction(PlayerAction action) noexcept;
+        
+        /// Takes the next action due by the end of the step, from the ghost playback or the input queue
+        ///
+        /// @param stepStartTime
+        ///     Elapsed time at the start of the step
+        /// @param stepEndTime
+        ///     Elapsed time at the end of the step
+        /// @param stepTimestamp
+        ///     Input clock time of this step
+        /// @param out_action
+        ///     Action to apply
+        /// @param out_time
+        ///     Elapsed time to apply it at
+        ///
+        /// @return FALSE if nothing more is due this step
+        ///
+        bool TryTakeNextAction(f32 stepStartTime, f32 stepEndTime, f64 stepTimestamp, PlayerAction& out_action, f32& out_time) noexcept;
+        
+        /// Advances the motion to the given elapsed time, presenting the new state if it changed
+        ///
+        /// @param time
+        ///     Elapsed time to advance to
+        ///
+        /// @return Whether the position changed
+        ///
+        bool StepMotion(f32 time) noexcept;
+        
+        /// Plays the animation and audio for the motion's current state
+        ///
+        void OnStateChanged() noexcept;
+        
+    private:
+        
+        PlayerMotion m_motion;
         CS::SpriteComponent* m_spriteComponent;
         
+        f32 m_elapsedTime = 0.0f;
+        GhostRun* m_recording = nullptr;
+        const GhostRun* m_playback = nullptr;
+        GhostRun::Cursor m_playbackCursor;
+        PlayerAction m_nextPlaybackAction = PlayerAction::k_jump;
+        f32 m_nextPlaybackTime = 0.0f;
+        bool m_hasNextPlaybackAction = false;
+        
+        PlayerInputQueue m_inputQueue;
+        f64 m_lastStepTimestamp = 0.0;
+        
 #ifndef CS_TARGETPLATFORM_RPI
         CS::CkAudioPlayer* m_audioPlayer = nullptr;
         CS::CkBankCSPtr m_audioBank;
 #endif
         
-        KeyframeAnimation m_runningAnimation;
-        KeyframeAnimation m_jumpingAnimation;
-        KeyframeAnimation m_bombingAnimation;
-        KeyframeAnimation m_slidingAnimation;
-        KeyframeAnimation m_collidingAnimation;
-        
-        PlayerState m_state = PlayerState::k_running;
-        
-        CS::EaseOutBackTween<f32> m_jumpTween;
-        CS::EaseOutBackTween<f32> m_bombTween;
-        CS::EaseInOutQuadTween<CS::Vector3> m_bumpTween;
-        
-        f32 m_slidingTimer = 0.0f;
+        AnimationClipTableCSPtr m_clipTable;
+        const AnimationClip* m_runningClip;
+        const AnimationClip* m_jumpingClip;
+        const AnimationClip* m_slidingClip;
+        const AnimationClip* m_collidingClip;
+        AnimationSystem* m_animationSystem;
+        u32 m_animationId;
     };
 };
 
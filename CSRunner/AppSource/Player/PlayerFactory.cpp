@@ -0,0 +1,84 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Player/PlayerFactory.h>
+
+#include <ChilliSource/Audio/CricketAudio.h>
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Rendering/Base.h>
+#include <ChilliSource/Rendering/Sprite.h>
+#include <ChilliSource/Rendering/Material.h>
+#include <ChilliSource/Rendering/Texture.h>
+
+#include <Animation/AnimationClipTable.h>
+#include <Player/PlayerController.h>
+#include <GameConfig.h>
+
+namespace CSRunner
+{
+    namespace PlayerFactory
+    {
+        //------------------------------------------------------------
+        CS::EntityUPtr CreatePlayer(AnimationSystem* animationSystem, CS::CkAudioPlayer* audioPlayer) noexcept
+        {
+            auto playerEntity = CS::Entity::Create();
+            
+            auto resourcePool = CS::Application::Get()->GetResourcePool();
+            auto texture = resourcePool->LoadResource<CS::Texture>(CS::StorageLocation::k_package, "TextureAtlases/Player/Player.csimage");
+            auto atlas = resourcePool->LoadResource<CS::TextureAtlas>(CS::StorageLocation::k_package, "TextureAtlases/Player/Player.csatlas");
+            auto clipTable = resourcePool->LoadResource<AnimationClipTable>(CS::StorageLocation::k_package, "TextureAtlases/Player/Player.csclips");
+  
+            auto materialFactory = CS::Application::Get()->GetSystem<CS::MaterialFactory>();
+            
+            auto material = resourcePool->GetResource<CS::Material>("Player");
+            if(material == nullptr)
+            {
+                material = materialFactory->CreateUnlit("Player", texture, true);
+            }
+            
+            auto playerSprite = std::make_shared<CS::SpriteComponent>(material, atlas, "Run_01", CS::Vector2(GameConfig::k_playerWidth, GameConfig::k_playerHeight), CS::SizePolicy::k_none);
+            playerEntity->AddComponent(playerSprite);
+
+#ifndef CS_TARGETPLATFORM_RPI
+            std::shared_ptr<PlayerController> playerController;
+            if(audioPlayer != nullptr)
+            {
+                auto audioBank = resourcePool->LoadResource<CS::CkBank>(CS::StorageLocation::k_package, "SFX/SFX.ckb");
+                playerController = std::make_shared<PlayerController>(playerSprite.get(), animationSystem, clipTable, audioPlayer, audioBank);
+            }
+            else
+            {
+                playerController = std::make_shared<PlayerController>(playerSprite.get(), animationSystem, clipTable);
+            }
+#else
+            auto playerController = std::make_shared<PlayerController>(playerSprite.get(), animationSystem, clipTable);
+#endif
+            playerEntity->AddComponent(playerController);
+            
+            playerEntity->GetTransform().SetPosition(GameConfig::k_startingX, GameConfig::k_groundY, 0.0f);
+            return playerEntity;
+        }
+    }
+}
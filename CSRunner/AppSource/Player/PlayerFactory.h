@@ -0,0 +1,49 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_PLAYER_PLAYERFACTORY_H_
+#define _APPSOURCE_PLAYER_PLAYERFACTORY_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Entity.h>
+
+namespace CSRunner
+{
+    namespace PlayerFactory
+    {
+        /// Creates the player "runner" entity standing at the start position
+        ///
+        /// @param animationSystem
+        ///     Used by the player controller to play player animations
+        /// @param audioPlayer
+        ///     Used by the player controller to play player audio. May be null for a silent player.
+        ///
+        /// @return The new player entity with a PlayerController component
+        ///
+        CS::EntityUPtr CreatePlayer(AnimationSystem* animationSystem, CS::CkAudioPlayer* audioPlayer) noexcept;
+    }
+}
+
+#endif
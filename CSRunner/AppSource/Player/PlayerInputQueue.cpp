@@ -0,0 +1,68 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Player/PlayerInputQueue.h>
+
+#include <chrono>
+
+namespace CSRunner
+{
+    //------------------------------------------------------------
+    f64 PlayerInputQueue::GetTimestamp() noexcept
+    {
+        return std::chrono::duration<f64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    
+    //------------------------------------------------------------
+    void PlayerInputQueue::Push(PlayerAction action) noexcept
+    {
+        TimedAction timedAction;
+        timedAction.m_action = action;
+        timedAction.m_timestamp = GetTimestamp();
+        m_actions.TryPush(timedAction);
+    }
+    
+    //------------------------------------------------------------
+    void PlayerInputQueue::Push(PlayerAction action, f64 gamepadTimestamp) noexcept
+    {
+        f64 arrivalTimestamp = GetTimestamp();
+        f64 offset = arrivalTimestamp - gamepadTimestamp;
+        if(m_hasGamepadClockOffset == false || offset < m_gamepadClockOffset)
+        {
+            m_gamepadClockOffset = offset;
+            m_hasGamepadClockOffset = true;
+        }
+        
+        TimedAction timedAction;
+        timedAction.m_action = action;
+        timedAction.m_timestamp = gamepadTimestamp + m_gamepadClockOffset;
+        m_actions.TryPush(timedAction);
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerInputQueue::TryPop(TimedAction& out_action) noexcept
+    {
+        return m_actions.TryPop(out_action);
+    }
+}
@@ -0,0 +1,95 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_PLAYER_PLAYERINPUTQUEUE_H_
+#define _APPSOURCE_PLAYER_PLAYERINPUTQUEUE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <Common/SpscQueue.h>
+#include <Player/PlayerMotion.h>
+
+namespace CSRunner
+{
+    /// Queue of player actions from every input source, each stamped with the time it happened.
+    /// The PlayerController drains it each step and applies each action at the point within the
+    /// step that matches when it happened, rather than all at the step boundary.
+    ///
+    /// Actions are stamped on one monotonic clock. Gamepad events carry an OS timestamp on a
+    /// clock of their own, which is mapped onto it by a measured offset. The engine's keyboard
+    /// and drag events carry no timestamp, so those are stamped when they arrive.
+    ///
+    class PlayerInputQueue final
+    {
+    public:
+        
+        /// An action and the time it arrived
+        ///
+        struct TimedAction final
+        {
+            PlayerAction m_action = PlayerAction::k_jump;
+            f64 m_timestamp = 0.0;
+        };
+        
+        /// @return Seconds on the clock used to stamp actions
+        ///
+        static f64 GetTimestamp() noexcept;
+        
+        /// Stamps an action with the time it arrived and queues it, for sources that carry no
+        /// timestamp. If the queue is full the action is dropped, as the player can't act on
+        /// that many in one step anyway.
+        ///
+        /// @param action
+        ///     Action to queue
+        ///
+        void Push(PlayerAction action) noexcept;
+        
+        /// Queues an action stamped by the OS on the gamepad clock. An event can't be delivered
+        /// before it happens, so the smallest difference yet seen between the arrival time and the
+        /// gamepad timestamp is the closest measure of the offset between the clocks, and is used
+        /// to map the timestamp across.
+        ///
+        /// @param action
+        ///     Action to queue
+        /// @param gamepadTimestamp
+        ///     Seconds on the gamepad clock at which the action happened
+        ///
+        void Push(PlayerAction action, f64 gamepadTimestamp) noexcept;
+        
+        /// @param out_action
+        ///     Oldest queued action
+        ///
+        /// @return FALSE if the queue is empty
+        ///
+        bool TryPop(TimedAction& out_action) noexcept;
+        
+    private:
+        
+        SpscQueue<TimedAction, 16> m_actions;
+        f64 m_gamepadClockOffset = 0.0;
+        bool m_hasGamepadClockOffset = false;
+    };
+}
+
+#endif
@@ -0,0 +1,218 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Player/PlayerMotion.h>
+
+#include <GameConfig.h>
+
+namespace CSRunner
+{
+    namespace
+    {
+        constexpr u32 k_numStates = u32(PlayerState::k_colliding) + 1;
+        constexpr u32 k_numActions = u32(PlayerAction::k_bump) + 1;
+    }
+    
+    //------------------------------------------------------------
+    PlayerMotion::PlayerMotion() noexcept
+    : m_position(GameConfig::k_startingX, GameConfig::k_groundY, 0.0f)
+    {
+        //The player is aligned on the ground, so the box sits above its position
+        m_localCollisionBox.vOrigin = CS::Vector2(0.0f, GameConfig::k_playerHeight * 0.5f);
+        m_localCollisionBox.vSize = CS::Vector2(GameConfig::k_playerWidth * GameConfig::k_playerWidthCollisionScale, GameConfig::k_playerHeight);
+    }
+    
+    //------------------------------------------------------------
+    CS::Rectangle PlayerMotion::GetCollisionBox() const noexcept
+    {
+        CS::Rectangle box = m_localCollisionBox;
+        box.vOrigin += m_position.XY();
+        return box;
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::Jump() noexcept
+    {
+        return Perform(PlayerAction::k_jump);
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::Slide() noexcept
+    {
+        return Perform(PlayerAction::k_slide);
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::Bump() noexcept
+    {
+        return Perform(PlayerAction::k_bump);
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::Perform(PlayerAction action) noexcept
+    {
+        static constexpr StartFunction k_startFunctions[] =
+        {
+            &PlayerMotion::StartNone,
+            &PlayerMotion::StartJump,
+            &PlayerMotion::StartSlide,
+            &PlayerMotion::StartBomb,
+            &PlayerMotion::StartBump
+        };
+        
+        const Transition& transition = GetTransition(m_state, action);
+        if(transition.m_allowed == false)
+        {
+            return false;
+        }
+        
+        m_state = transition.m_nextState;
+        m_localCollisionBox.vSize.y = transition.m_collisionHeight;
+        (this->*k_startFunctions[u32(transition.m_movement)])();
+        return true;
+    }
+    
+    //------------------------------------------------------------
+    void PlayerMotion::Run() noexcept
+    {
+        m_state = PlayerState::k_running;
+        m_localCollisionBox.vSize.y = GameConfig::k_playerHeight;
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::Step(f32 timeSinceLastUpdate) noexcept
+    {
+        static constexpr StepFunction k_stepFunctions[k_numStates] =
+        {
+            &PlayerMotion::StepRunning,
+            &PlayerMotion::StepJumping,
+            &PlayerMotion::StepSliding,
+            &PlayerMotion::StepBombing,
+            &PlayerMotion::StepColliding
+        };
+        
+        return (this->*k_stepFunctions[u32(m_state)])(timeSinceLastUpdate);
+    }
+    
+    //------------------------------------------------------------
+    const PlayerMotion::Transition& PlayerMotion::GetTransition(PlayerState state, PlayerAction action) noexcept
+    {
+        constexpr Transition k_ignored = { false, PlayerState::k_running, 0.0f, Movement::k_none };
+        constexpr Transition k_toJumping = { true, PlayerState::k_jumping, GameConfig::k_playerHeight, Movement::k_jump };
+        constexpr Transition k_toSliding = { true, PlayerState::k_sliding, GameConfig::k_playerSlideHeight, Movement::k_slide };
+        constexpr Transition k_toBombing = { true, PlayerState::k_bombing, GameConfig::k_playerHeight, Movement::k_bomb };
+        constexpr Transition k_toColliding = { true, PlayerState::k_colliding, GameConfig::k_playerHeight, Movement::k_bump };
+        
+        //Rows are states and columns are actions, both in declaration order
+        static constexpr Transition k_transitions[k_numStates][k_numActions] =
+        {
+            //Jump          Slide          Bump
+            { k_toJumping,  k_toSliding,   k_toColliding },  //Running
+            { k_ignored,    k_toBombing,   k_toColliding },  //Jumping
+            { k_toJumping,  k_ignored,     k_toColliding },  //Sliding
+            { k_ignored,    k_ignored,     k_toColliding },  //Bombing
+            { k_ignored,    k_ignored,     k_ignored },      //Colliding
+        };
+        
+        return k_transitions[u32(state)][u32(action)];
+    }
+    
+    //------------------------------------------------------------
+    void PlayerMotion::StartJump() noexcept
+    {
+        m_jumpTween = CurveTween<f32>(&EasingCurve::GetEaseOutBack(), GameConfig::k_groundY, GameConfig::k_groundY + GameConfig::k_playerJumpHeight, GameConfig::k_playerJumpDuration, CS::TweenPlayMode::k_pingPong);
+    }
+    
+    //------------------------------------------------------------
+    void PlayerMotion::StartSlide() noexcept
+    {
+        m_slidingTimer = 0.0f;
+    }
+    
+    //------------------------------------------------------------
+    void PlayerMotion::StartBomb() noexcept
+    {
+        m_bombTween = CurveTween<f32>(&EasingCurve::GetEaseOutBack(), m_position.y, GameConfig::k_groundY, GameConfig::k_playerBombDuration, CS::TweenPlayMode::k_once);
+    }
+    
+    //------------------------------------------------------------
+    void PlayerMotion::StartBump() noexcept
+    {
+        m_bumpTween = CurveTween<CS::Vector3>(&EasingCurve::GetEaseInOutQuad(), m_position, CS::Vector3(m_position.x - GameConfig::k_playerBumpBackDistance, GameConfig::k_groundY, 0.0f), GameConfig::k_playerBumpDuration, CS::TweenPlayMode::k_once);
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::StepRunning(f32 timeSinceLastUpdate) noexcept
+    {
+        return false;
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::StepJumping(f32 timeSinceLastUpdate) noexcept
+    {
+        m_position.y = m_jumpTween.Update(timeSinceLastUpdate);
+        if(m_jumpTween.IsFinished() == true)
+        {
+            Run();
+        }
+        
+        return true;
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::StepSliding(f32 timeSinceLastUpdate) noexcept
+    {
+        m_slidingTimer += timeSinceLastUpdate;
+        if(m_slidingTimer >= GameConfig::k_playerSlideDuration)
+        {
+            Run();
+        }
+        
+        return false;
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::StepBombing(f32 timeSinceLastUpdate) noexcept
+    {
+        m_position.y = m_bombTween.Update(timeSinceLastUpdate);
+        if(m_bombTween.IsFinished() == true)
+        {
+            Run();
+        }
+        
+        return true;
+    }
+    
+    //------------------------------------------------------------
+    bool PlayerMotion::StepColliding(f32 timeSinceLastUpdate) noexcept
+    {
+        m_position = m_bumpTween.Update(timeSinceLastUpdate);
+        if(m_bumpTween.IsFinished() == true)
+        {
+            Run();
+        }
+        
+        return true;
+    }
+}
@@ -0,0 +1,197 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_PLAYER_PLAYERMOTION_H_
+#define _APPSOURCE_PLAYER_PLAYERMOTION_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Math.h>
+
+#include <Common/CurveTween.h>
+
+namespace CSRunner
+{
+    enum class PlayerState
+    {
+        k_running,
+        k_jumping,
+        k_sliding,
+        k_bombing,
+        k_colliding,
+    };
+    
+    /// The actions that can be asked of the player. These are what a ghost run records.
+    ///
+    enum class PlayerAction
+    {
+        k_jump,
+        k_slide,
+        k_bump
+    };
+    
+    /// The runner's state machine and movement, free of entities, animation and audio so that
+    /// it can be stepped off the main thread by the headless simulations. PlayerController
+    /// wraps one and presents it.
+    ///
+    /// The state machine is driven by shared constant tables rather than branching on the
+    /// state: actions look up their transition by state and action, and each step calls the
+    /// current state's update function, so any number of runners can be stepped without
+    /// allocating.
+    ///
+    /// The player starts on the ground at GameConfig::k_startingX.
+    ///
+    class PlayerMotion final
+    {
+    public:
+        
+        ///
+        PlayerMotion() noexcept;
+        
+        /// @return Current state
+        ///
+        PlayerState GetState() const noexcept { return m_state; }
+        
+        /// @return Current position
+        ///
+        const CS::Vector3& GetPosition() const noexcept { return m_position; }
+        
+        /// @return Collision box relative to the player's position
+        ///
+        const CS::Rectangle& GetLocalCollisionBox() const noexcept { return m_localCollisionBox; }
+        
+        /// @return Collision box at the player's current position
+        ///
+        CS::Rectangle GetCollisionBox() const noexcept;
+        
+        /// Jumps if running or sliding
+        ///
+        /// @return Whether the state changed
+        ///
+        bool Jump() noexcept;
+        
+        /// Slides if running, or bombs back to the ground if jumping
+        ///
+        /// @return Whether the state changed
+        ///
+        bool Slide() noexcept;
+        
+        /// Bumps back unless already colliding
+        ///
+        /// @return Whether the state changed
+        ///
+        bool Bump() noexcept;
+        
+        /// Performs Jump, Slide or Bump
+        ///
+        /// @param action
+        ///     Action to perform
+        ///
+        /// @return Whether the state changed
+        ///
+        bool Perform(PlayerAction action) noexcept;
+        
+        /// Returns to running
+        ///
+        void Run() noexcept;
+        
+        /// Advances the current action, returning to running once it is complete
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since the last step
+        ///
+        /// @return Whether the position changed
+        ///
+        bool Step(f32 timeSinceLastUpdate) noexcept;
+        
+    private:
+        
+        using StartFunction = void (PlayerMotion::*)();
+        using StepFunction = bool (PlayerMotion::*)(f32);
+        
+        /// The movement started on entering a state. Each has a start function.
+        ///
+        enum class Movement
+        {
+            k_none,
+            k_jump,
+            k_slide,
+            k_bomb,
+            k_bump
+        };
+        
+        /// The result of performing an action in a state
+        ///
+        struct Transition final
+        {
+            bool m_allowed;
+            PlayerState m_nextState;
+            f32 m_collisionHeight;
+            Movement m_movement;
+        };
+        
+        /// @param state
+        ///     Current state
+        /// @param action
+        ///     Action performed
+        ///
+        /// @return The transition for the action in that state
+        ///
+        static const Transition& GetTransition(PlayerState state, PlayerAction action) noexcept;
+        
+        /// Start functions, one per movement
+        ///
+        void StartNone() noexcept { }
+        void StartJump() noexcept;
+        void StartSlide() noexcept;
+        void StartBomb() noexcept;
+        void StartBump() noexcept;
+        
+        /// Step functions, one per state. Each advances the state's movement by the given
+        /// time, returning to running once it is complete.
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since the last step
+        ///
+        /// @return Whether the position changed
+        ///
+        bool StepRunning(f32 timeSinceLastUpdate) noexcept;
+        bool StepJumping(f32 timeSinceLastUpdate) noexcept;
+        bool StepSliding(f32 timeSinceLastUpdate) noexcept;
+        bool StepBombing(f32 timeSinceLastUpdate) noexcept;
+        bool StepColliding(f32 timeSinceLastUpdate) noexcept;
+        
+        PlayerState m_state = PlayerState::k_running;
+        CS::Vector3 m_position;
+        CS::Rectangle m_localCollisionBox;
+        
+        CurveTween<f32> m_jumpTween;
+        CurveTween<f32> m_bombTween;
+        CurveTween<CS::Vector3> m_bumpTween;
+        
+        f32 m_slidingTimer = 0.0f;
+    };
+}
+
+#endif
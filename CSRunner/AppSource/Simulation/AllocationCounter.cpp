@@ -0,0 +1,113 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Simulation/AllocationCounter.h>
+
+#if defined(CSRUNNER_HEADLESS_SIMULATION)
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local u64 g_threadAllocationCount = 0;
+    
+    //------------------------------------------------------------
+    void* CountedAllocate(std::size_t size) noexcept
+    {
+        ++g_threadAllocationCount;
+        return std::malloc(size > 0 ? size : 1);
+    }
+}
+
+//------------------------------------------------------------
+void* operator new(std::size_t size)
+{
+    void* memory = CountedAllocate(size);
+    if(memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+//------------------------------------------------------------
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+//------------------------------------------------------------
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(size);
+}
+
+//------------------------------------------------------------
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(size);
+}
+
+//------------------------------------------------------------
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+//------------------------------------------------------------
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+//------------------------------------------------------------
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+//------------------------------------------------------------
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+#endif
+
+namespace CSRunner
+{
+    namespace AllocationCounter
+    {
+        //------------------------------------------------------------
+        u64 GetThreadAllocationCount() noexcept
+        {
+#if defined(CSRUNNER_HEADLESS_SIMULATION)
+            return g_threadAllocationCount;
+#else
+            return 0;
+#endif
+        }
+    }
+}
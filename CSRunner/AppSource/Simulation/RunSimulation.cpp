@@ -0,0 +1,102 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Simulation/RunSimulation.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <Environment/ObstacleSequencer.h>
+#include <Player/AutoPlayer.h>
+
+namespace CSRunner
+{
+    //------------------------------------------------------------
+    RunSimulation::RunSimulation(u32 seed, const DifficultyConfig& config, const ObstacleCatalogue& catalogue, const ObstaclePatternLibraryCSPtr& patterns) noexcept
+    : m_config(config), m_stream(config, catalogue, ObstacleSequencer::Create(seed, catalogue, patterns, config, ObstacleSequencer::RefillMode::k_inline))
+    {
+    }
+    
+    //------------------------------------------------------------
+    void RunSimulation::Run(f32 stepInterval, f32 maxSeconds) noexcept
+    {
+        CS_ASSERT(stepInterval > 0.0f, "Step interval must be positive.");
+        
+        while(m_isGameOver == false && m_simulatedSeconds < maxSeconds)
+        {
+            Step(stepInterval);
+        }
+    }
+    
+    //------------------------------------------------------------
+    void RunSimulation::Step(f32 stepInterval) noexcept
+    {
+        //Obstacle bounds are local to the scrolling world so bring the player into that space to decide
+        CS::Rectangle playerBox = m_player.GetCollisionBox();
+        playerBox.vOrigin.x -= m_stream.GetScrollX();
+        
+        switch(AutoPlayer::Decide(m_stream.GetObstacles(), playerBox, m_config.m_scrollSpeed))
+        {
+            case AutoPlayer::Action::k_jump:
+                m_player.Jump();
+                break;
+            case AutoPlayer::Action::k_slide:
+                m_player.Slide();
+                break;
+            case AutoPlayer::Action::k_none:
+                break;
+        }
+        
+        m_player.Step(stepInterval);
+        m_stream.Scroll(stepInterval);
+        m_stream.Cull(nullptr);
+        m_stream.TrySpawn(nullptr);
+        StepCollision();
+        
+        m_simulatedSeconds += stepInterval;
+    }
+    
+    //------------------------------------------------------------
+    void RunSimulation::StepCollision() noexcept
+    {
+        CS::Rectangle playerBox = m_player.GetCollisionBox();
+        auto obstacle = m_stream.FindFirstHit(playerBox, m_hasPreviousPlayerBox == true ? &m_previousPlayerBox : nullptr);
+        
+        m_previousPlayerBox = playerBox;
+        m_hasPreviousPlayerBox = true;
+        
+        if(obstacle != nullptr)
+        {
+            ++m_numCollisions;
+            m_player.Bump();
+            
+            auto& obstacles = m_stream.GetObstacles();
+            obstacles.Kill(*obstacles.TryGet(obstacles.GetHandle(*obstacle)));
+            
+            if(m_player.GetPosition().x <= GameConfig::k_cullX)
+            {
+                m_isGameOver = true;
+            }
+        }
+    }
+}
@@ -0,0 +1,109 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SIMULATION_RUNSIMULATION_H_
+#define _APPSOURCE_SIMULATION_RUNSIMULATION_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Math.h>
+
+#include <Environment/LevelStream.h>
+#include <Player/PlayerMotion.h>
+#include <GameConfig.h>
+
+namespace CSRunner
+{
+    /// A single auto played run of the level with no entities, resources or systems, so that
+    /// many can run at once on background tasks. Steps the same LevelStream that the
+    /// LevelGeneratorSystem and CollisionSystem wrap, along with the same player motion and auto
+    /// player decision, so the same seed and config play out the same as the headless
+    /// SimulationState.
+    ///
+    /// Obstacles are generated inline, so a run only touches its own data and the read only
+    /// catalogue and patterns.
+    ///
+    class RunSimulation final
+    {
+    public:
+        
+        /// @param seed
+        ///     Level seed
+        /// @param config
+        ///     Difficulty to play at
+        /// @param catalogue
+        ///     Obstacle descriptions. Must outlive the run.
+        /// @param patterns
+        ///     Authored patterns to mix in. May be null.
+        ///
+        RunSimulation(u32 seed, const DifficultyConfig& config, const ObstacleCatalogue& catalogue, const ObstaclePatternLibraryCSPtr& patterns) noexcept;
+        
+        /// Steps the run until the player is bumped offscreen or the time limit is reached
+        ///
+        /// @param stepInterval
+        ///     Fixed time in seconds per step
+        /// @param maxSeconds
+        ///     Simulated time after which the run is stopped
+        ///
+        void Run(f32 stepInterval, f32 maxSeconds) noexcept;
+        
+        /// @return Simulated seconds survived
+        ///
+        f32 GetSurvivedSeconds() const noexcept { return m_simulatedSeconds; }
+        
+        /// @return Number of obstacles hit
+        ///
+        u32 GetNumCollisions() const noexcept { return m_numCollisions; }
+        
+        /// @return Whether the player was bumped offscreen, rather than surviving to the time limit
+        ///
+        bool IsGameOver() const noexcept { return m_isGameOver; }
+        
+    private:
+        
+        /// Advances every part of the run by one fixed step, in the same order as the game
+        ///
+        /// @param stepInterval
+        ///     Time in seconds
+        ///
+        void Step(f32 stepInterval) noexcept;
+        
+        /// Tests the player's swept box against the obstacles and applies the game's response
+        ///
+        void StepCollision() noexcept;
+        
+        DifficultyConfig m_config;
+        LevelStream m_stream;
+        PlayerMotion m_player;
+        
+        CS::Rectangle m_previousPlayerBox;
+        bool m_hasPreviousPlayerBox = false;
+        
+        f32 m_simulatedSeconds = 0.0f;
+        u32 m_numCollisions = 0;
+        bool m_isGameOver = false;
+    };
+}
+
+#endif
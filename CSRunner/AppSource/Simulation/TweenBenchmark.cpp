@@ -0,0 +1,173 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Simulation/TweenBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Core/Tween.h>
+
+#include <Common/CurveTween.h>
+#include <Common/EasingCurve.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace CSRunner
+{
+    namespace TweenBenchmark
+    {
+        namespace
+        {
+            constexpr u32 k_numErrorSamples = 100000;
+            constexpr u32 k_numTweens = 10000;
+            constexpr u32 k_numUpdates = 120;
+            constexpr u32 k_numTimingRounds = 6;
+            constexpr f32 k_updateInterval = 1.0f / 60.0f;
+            constexpr f32 k_tweenDuration = 0.7f;
+            
+            /// Receives the sum of the timed values, so the updates can't be optimised away
+            ///
+            volatile f32 g_checksumSink = 0.0f;
+            
+            /// @param curve
+            ///     Lookup table to check
+            /// @param function
+            ///     Function the table was sampled from
+            ///
+            /// @return Largest difference between the two across [0, 1]
+            ///
+            f32 GetMaxError(const EasingCurve& curve, f32 (*function)(f32)) noexcept
+            {
+                f32 maxError = 0.0f;
+                for(u32 i = 0; i <= k_numErrorSamples; ++i)
+                {
+                    f32 t = f32(i) / f32(k_numErrorSamples);
+                    maxError = std::max(maxError, std::abs(curve.Evaluate(t) - function(t)));
+                }
+                return maxError;
+            }
+            
+            /// Updates every tween for the set number of frames, restarting them in ping-pong
+            /// as the player's jump does
+            ///
+            /// @param tweens
+            ///     Tweens to update
+            ///
+            /// @return Nanoseconds per tween update
+            ///
+            template <typename TTween> f64 TimeUpdates(std::vector<TTween>& tweens) noexcept
+            {
+                f32 checksum = 0.0f;
+                auto start = std::chrono::steady_clock::now();
+                for(u32 update = 0; update < k_numUpdates; ++update)
+                {
+                    for(auto& tween : tweens)
+                    {
+                        checksum += tween.Update(k_updateInterval);
+                    }
+                }
+                f64 elapsed = std::chrono::duration<f64, std::nano>(std::chrono::steady_clock::now() - start).count();
+                g_checksumSink = checksum;
+                
+                return elapsed / f64(k_numTweens * k_numUpdates);
+            }
+            
+            /// Updates both sets of tweens in lockstep, as TimeUpdates does
+            ///
+            /// @param analyticTweens
+            ///     Tweens evaluated analytically
+            /// @param curveTweens
+            ///     The matching tweens evaluated from the lookup table
+            ///
+            /// @return Mean absolute difference between the matching values across every update
+            ///
+            f32 GetMeanUpdateError(std::vector<CS::EaseOutBackTween<f32>>& analyticTweens, std::vector<CurveTween<f32>>& curveTweens) noexcept
+            {
+                f64 totalError = 0.0;
+                for(u32 update = 0; update < k_numUpdates; ++update)
+                {
+                    for(u32 i = 0; i < k_numTweens; ++i)
+                    {
+                        totalError += std::abs(analyticTweens[i].Update(k_updateInterval) - curveTweens[i].Update(k_updateInterval));
+                    }
+                }
+                
+                return f32(totalError / f64(k_numTweens * k_numUpdates));
+            }
+        }
+        
+        //------------------------------------------------------------
+        void Run() noexcept
+        {
+            CS_LOG_VERBOSE("Tween benchmark: " + CS::ToString(EasingCurve::k_numSamples) + " samples per curve.");
+            CS_LOG_VERBOSE("EaseOutBack max error: " + CS::ToString(GetMaxError(EasingCurve::GetEaseOutBack(), &Easing::EaseOutBack)));
+            CS_LOG_VERBOSE("EaseInOutQuad max error: " + CS::ToString(GetMaxError(EasingCurve::GetEaseInOutQuad(), &Easing::EaseInOutQuad)));
+            
+            std::vector<CS::EaseOutBackTween<f32>> analyticTweens;
+            std::vector<CurveTween<f32>> curveTweens;
+            analyticTweens.reserve(k_numTweens);
+            curveTweens.reserve(k_numTweens);
+            for(u32 i = 0; i < k_numTweens; ++i)
+            {
+                //Stagger the durations so that the tweens are at different points on the curve
+                f32 duration = k_tweenDuration + f32(i % 16) * 0.01f;
+                
+                auto analyticTween = CS::MakeEaseOutBackTween(0.0f, 1.0f, duration);
+                analyticTween.Play(CS::TweenPlayMode::k_pingPong);
+                analyticTweens.push_back(analyticTween);
+                
+                curveTweens.push_back(CurveTween<f32>(&EasingCurve::GetEaseOutBack(), 0.0f, 1.0f, duration, CS::TweenPlayMode::k_pingPong));
+            }
+            
+            //The error is measured on copies so that the timed tweens start from the same state
+            auto analyticErrorTweens = analyticTweens;
+            auto curveErrorTweens = curveTweens;
+            f32 meanError = GetMeanUpdateError(analyticErrorTweens, curveErrorTweens);
+            
+            //Alternate which pass runs first so that neither always pays for a cold cache, and keep the best of each
+            f64 analyticCost = std::numeric_limits<f64>::max();
+            f64 curveCost = std::numeric_limits<f64>::max();
+            for(u32 round = 0; round < k_numTimingRounds; ++round)
+            {
+                if(round % 2 == 0)
+                {
+                    analyticCost = std::min(analyticCost, TimeUpdates(analyticTweens));
+                    curveCost = std::min(curveCost, TimeUpdates(curveTweens));
+                }
+                else
+                {
+                    curveCost = std::min(curveCost, TimeUpdates(curveTweens));
+                    analyticCost = std::min(analyticCost, TimeUpdates(analyticTweens));
+                }
+            }
+            
+            CS_LOG_VERBOSE(CS::ToString(k_numTweens) + " tweens x " + CS::ToString(k_numUpdates) + " updates, best of " + CS::ToString(k_numTimingRounds) + " alternating rounds. Analytic: " + CS::ToString(f32(analyticCost)) + " ns per update, curve: " + CS::ToString(f32(curveCost)) + " ns per update.");
+            CS_LOG_VERBOSE("Mean absolute value difference per update: " + CS::ToString(meanError));
+        }
+    }
+}
@@ -0,0 +1,46 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_SIMULATION_TWEENBENCHMARK_H_
+#define _APPSOURCE_SIMULATION_TWEENBENCHMARK_H_
+
+#include <ForwardDeclarations.h>
+
+namespace CSRunner
+{
+    /// Compares the lookup table easing curves used by CurveTween with analytic evaluation.
+    /// Logs the worst error of each curve against its easing function, and the cost per update
+    /// of thousands of CurveTweens against the same number of the engine's analytic tweens.
+    ///
+    /// Runs at startup when CSRUNNER_TWEEN_BENCHMARK is defined.
+    ///
+    namespace TweenBenchmark
+    {
+        /// Runs the comparison on the calling thread and logs the results
+        ///
+        void Run() noexcept;
+    }
+}
+
+#endif
@@ -42,20 +42,33 @@
 #include <ChilliSource/Input/Keyboard.h>
 #include <ChilliSource/Input/Gamepad.h>
 
+#include <Animation/AnimationClipTable.h>
+#include <Animation/AnimationSystem.h>
 #include <Collision/CollisionSystem.h>
 #include <Player/PlayerController.h>
+#include <Player/PlayerFactory.h>
 #include <Environment/LevelGeneratorSystem.h>
+#include <Common/TweenSystem.h>
 #include <Transition/TransitionSystem.h>
 #include <States/GameoverState.h>
 
 #include <GameConfig.h>
 
+#include <limits>
+
 namespace CSRunner
 {
     namespace
     {
         constexpr u32 k_moveGamepadAction = 0;
         
+        const std::string k_ghostRunPath = "BestRun.csghost";
+        
+        /// The ghost is drawn behind the player
+        ///
+        constexpr f32 k_ghostDepth = 0.5f;
+        const CS::Colour k_ghostColour(1.0f, 1.0f, 1.0f, 0.4f);
+        
         /// The viewport of the camera has a fixed width so that you always see the same distance in front
         /// but the height will adapt to maintain display aspect ratio
         ///
@@ -69,47 +82,20 @@ namespace CSRunner
             cameraEntity->GetTransform().SetLookAt(CS::Vector3(0.0f, 0.0f, -5.0f), CS::Vector3::k_zero, CS::Vector3::k_unitPositiveY);
             return cameraEntity;
         }
-        
-        /// @param audioPlayer
-        ///     Used by the player controller to play player audio
-        ///
-        CS::EntityUPtr CreatePlayer(CS::CkAudioPlayer* audioPlayer) noexcept
-        {
-            auto playerEntity = CS::Entity::Create();
-            
-            auto resourcePool = CS::Application::Get()->GetResourcePool();
-            auto texture = resourcePool->LoadResource<CS::Texture>(CS::StorageLocation::k_package, "TextureAtlases/Player/Player.csimage");
-            auto atlas = resourcePool->LoadResource<CS::TextureAtlas>(CS::StorageLocation::k_package, "TextureAtlases/Player/Player.csatlas");
-  
-            auto materialFactory = CS::Application::Get()->GetSystem<CS::MaterialFactory>();
-            
-            auto material = resourcePool->GetResource<CS::Material>("Player");
-            if(material == nullptr)
-            {
-                material = materialFactory->CreateUnlit("Player", texture, true);
-            }
-            
-            auto playerSprite = std::make_shared<CS::SpriteComponent>(material, atlas, "Run_01", CS::Vector2(GameConfig::k_playerWidth, GameConfig::k_playerHeight), CS::SizePolicy::k_none);
-            playerEntity->AddComponent(playerSprite);
-
-#ifndef CS_TARGETPLATFORM_RPI
-            auto audioBank = resourcePool->LoadResource<CS::CkBank>(CS::StorageLocation::k_package, "SFX/SFX.ckb");
-            auto playerController = std::make_shared<PlayerController>(playerSprite.get(), audioPlayer, audioBank);
-#else
-            auto playerController = std::make_shared<PlayerController>(playerSprite.get());
-#endif
-            playerEntity->AddComponent(playerController);
-            
-            playerEntity->GetTransform().SetPosition(GameConfig::k_startingX, GameConfig::k_groundY, 0.0f);
-            return playerEntity;
-        }
     }
     
     //------------------------------------------------------------
     void GameState::CreateSystems() noexcept
     {
-        m_transitionSystem = CreateSystem<TransitionSystem>(0.0f, 1.0f);
-        m_levelGenerator = CreateSystem<LevelGeneratorSystem>();
+        auto tweenSystem = CreateSystem<TweenSystem>();
+        m_transitionSystem = CreateSystem<TransitionSystem>(tweenSystem, 0.0f, 1.0f);
+        m_animationSystem = CreateSystem<AnimationSystem>();
+        //Race the best run on its own level, otherwise start a fresh one
+        m_bestRun = GhostRun::Load(CS::StorageLocation::k_saveData, k_ghostRunPath);
+        u32 seed = m_bestRun != nullptr ? m_bestRun->GetSeed() : CS::Random::Generate(0u, std::numeric_limits<u32>::max());
+        m_recording = GhostRunUPtr(new GhostRun(seed));
+        
+        m_levelGenerator = CreateSystem<LevelGeneratorSystem>(m_animationSystem, seed, DifficultyConfig(), ObstacleSequencer::RefillMode::k_background);
         m_collisionSystem = CreateSystem<CollisionSystem>(m_levelGenerator);
         m_gestureSystem = CreateSystem<CS::GestureSystem>();
         
@@ -126,11 +112,17 @@ namespace CSRunner
         GetMainScene()->Add(CreateCamera());
 
         //Create the player "runner"
-        auto player = CreatePlayer(m_audioPlayer);
+        auto player = PlayerFactory::CreatePlayer(m_animationSystem, m_audioPlayer);
         m_playerController = player->GetComponent<PlayerController>().get();
+        m_playerController->SetRecording(m_recording.get());
         m_collisionSystem->SetPlayer(m_playerController);
         GetMainScene()->Add(std::move(player));
         
+        if(m_bestRun != nullptr)
+        {
+            CreateGhost();
+        }
+        
 #ifndef CS_TARGETPLATFORM_RPI
         m_audioPlayer->SetMusicVolume(0.5f);
         m_audioPlayer->PlayMusic(CS::StorageLocation::k_package, "Music/GameMusic.cks");
@@ -140,7 +132,7 @@ namespace CSRunner
         auto gameViewDef = CS::Application::Get()->GetResourcePool()->LoadResource<CS::WidgetTemplate>(CS::StorageLocation::k_package, "GUI/Game.csui");
         CS::WidgetSPtr gameView = CS::Application::Get()->GetWidgetFactory()->Create(gameViewDef);
         GetUICanvas()->AddWidget(gameView);
-        m_timeSurvivedLabel = gameView->GetWidgetRecursive("Time")->GetComponent<CS::TextUIComponent>();
+        m_timeSurvivedText = TextBinding(gameView->GetWidgetRecursive("Time")->GetComponent<CS::TextUIComponent>(), "Survived for ", " seconds");
         
         
         //Subscribe for collision events
@@ -174,7 +166,12 @@ namespace CSRunner
             m_gamepadAxisEventConnection = gamepadSystem->GetMappedAxisPositionChangedEvent().OpenConnection(CS::MakeDelegate(this, &GameState::OnGamepadAxisMoved));
         }
         
-        m_keyboard = CS::Application::Get()->GetSystem<CS::Keyboard>();
+        //Keys are taken as press events, so each press acts once and a held key doesn't keep jumping
+        auto keyboard = CS::Application::Get()->GetSystem<CS::Keyboard>();
+        if(keyboard != nullptr)
+        {
+            m_keyPressedEventConnection = keyboard->GetKeyPressedEvent().OpenConnection(CS::MakeDelegate(this, &GameState::OnKeyPressed));
+        }
     }
 
     //------------------------------------------------------------
@@ -183,29 +180,17 @@ namespace CSRunner
         if(m_transitionSystem->IsTransitioning() == false)
         {
             m_timeSurvived += timeSinceLastUpdate;
-            m_timeSurvivedLabel->SetText("Survived for " + CS::ToString((u32)m_timeSurvived) + " seconds");
-            
-            if(m_keyboard != nullptr)
-            {
-                if(m_keyboard->IsKeyDown(CS::KeyCode::k_up) || m_keyboard->IsKeyDown(CS::KeyCode::k_w))
-                {
-                    m_playerController->Jump();
-                }
-                else if(m_keyboard->IsKeyDown(CS::KeyCode::k_down) || m_keyboard->IsKeyDown(CS::KeyCode::k_s))
-                {
-                    m_playerController->Slide();
-                }
-            }
+            m_timeSurvivedText.SetValue((u32)m_timeSurvived);
         }
     }
     
     //------------------------------------------------------------
-    void GameState::OnPlayerObstacleCollision(u32 index) noexcept
+    void GameState::OnPlayerObstacleCollision(const ObstacleHandle& handle) noexcept
     {
         if(m_transitionSystem->IsTransitioning() == false)
         {
             m_playerController->Bump();
-            m_levelGenerator->DestroyObstacle(index);
+            m_levelGenerator->DestroyObstacle(handle);
             
             //Check to see if the player has been bumped offscreen
             if(m_playerController->GetEntity()->GetTransform().GetLocalPosition().x <= GameConfig::k_cullX)
@@ -214,22 +199,69 @@ namespace CSRunner
                 m_dragMovedEventConnection.reset();
                 m_obstacleCollisionEventConnection.reset();
                 m_gamepadAxisEventConnection.reset();
+                m_keyPressedEventConnection.reset();
                 
+                SaveRecording();
                 m_transitionSystem->Transition(std::make_shared<GameoverState>(m_timeSurvived));
             }
         }
     }
 
+    //------------------------------------------------------------
+    void GameState::CreateGhost() noexcept
+    {
+        auto ghost = PlayerFactory::CreatePlayer(m_animationSystem, nullptr);
+        ghost->GetComponent<CS::SpriteComponent>()->SetColour(k_ghostColour);
+        ghost->GetComponent<PlayerController>()->SetPlayback(m_bestRun.get());
+        
+        //The ghost sets its own position as it moves, so it is offset in depth through a parent
+        auto ghostRoot = CS::Entity::Create();
+        ghostRoot->GetTransform().SetPosition(0.0f, 0.0f, k_ghostDepth);
+        ghostRoot->AddEntity(std::move(ghost));
+        GetMainScene()->Add(std::move(ghostRoot));
+    }
+    
+    //------------------------------------------------------------
+    void GameState::SaveRecording() noexcept
+    {
+        m_playerController->SetRecording(nullptr);
+        m_recording->SetDuration(m_timeSurvived);
+        
+        if(m_bestRun == nullptr || m_recording->GetDuration() > m_bestRun->GetDuration())
+        {
+            m_recording->Save(CS::StorageLocation::k_saveData, k_ghostRunPath);
+            CS_LOG_VERBOSE("New best run saved: " + CS::ToString(m_recording->GetDuration()) + " s in " + CS::ToString(m_recording->GetNumBytes()) + " bytes of actions.");
+        }
+    }
+    
+    //------------------------------------------------------------
+    void GameState::OnKeyPressed(CS::KeyCode keyCode, const std::vector<CS::ModifierKeyCode>& modifierKeys) noexcept
+    {
+        if(m_transitionSystem->IsTransitioning() == true)
+        {
+            return;
+        }
+        
+        if(keyCode == CS::KeyCode::k_up || keyCode == CS::KeyCode::k_w)
+        {
+            m_playerController->QueueAction(PlayerAction::k_jump);
+        }
+        else if(keyCode == CS::KeyCode::k_down || keyCode == CS::KeyCode::k_s)
+        {
+            m_playerController->QueueAction(PlayerAction::k_slide);
+        }
+    }
+    
     //------------------------------------------------------------
     void GameState::OnDragged(const CS::DragGesture* gesture, const CS::DragGesture::DragInfo& info) noexcept
     {
         if(info.m_delta.y > m_minDragDistance)
         {
-            m_playerController->Jump();
+            m_playerController->QueueAction(PlayerAction::k_jump);
         }
         else if(info.m_delta.y < -m_minDragDistance)
         {
-            m_playerController->Slide();
+            m_playerController->QueueAction(PlayerAction::k_slide);
         }
     }
     
@@ -240,11 +272,11 @@ namespace CSRunner
         {
             if(position > 0.1f)
             {
-                m_playerController->Slide();
+                m_playerController->QueueAction(PlayerAction::k_slide, timestamp);
             }
             else if(position < -0.1f)
             {
-                m_playerController->Jump();
+                m_playerController->QueueAction(PlayerAction::k_jump, timestamp);
             }
         }
     }
@@ -256,5 +288,6 @@ namespace CSRunner
         m_dragMovedEventConnection.reset();
         m_obstacleCollisionEventConnection.reset();
         m_gamepadAxisEventConnection.reset();
+        m_keyPressedEventConnection.reset();
     }
 }
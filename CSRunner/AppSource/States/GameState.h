@@ -29,6 +29,10 @@
 
 #include <ChilliSource/Core/State.h>
 #include <ChilliSource/Input/Gesture.h>
+#include <ChilliSource/Input/Keyboard.h>
+
+#include <Common/TextBinding.h>
+#include <Player/GhostRun.h>
 
 namespace CSRunner
 {
@@ -36,6 +40,9 @@ namespace CSRunner
     /// Responsible for creating and updating all the main systems
     /// including the HUD, player and "physics".
     ///
+    /// Every run is recorded. Once there is a saved best run the level is generated from its
+    /// seed and a ghost of it races alongside the player; beating it replaces the saved run.
+    ///
     class GameState final : public CS::State
     {
     private:
@@ -55,6 +62,16 @@ namespace CSRunner
         ///
         void OnUpdate(f32 timeSinceLastUpdate) noexcept override;
         
+        /// Called by the keyboard when a key is pressed. Used to make the runner jump or slide
+        /// depending on the key.
+        ///
+        /// @param keyCode
+        ///     Key that was pressed
+        /// @param modifierKeys
+        ///     Modifier keys held at the time
+        ///
+        void OnKeyPressed(CS::KeyCode keyCode, const std::vector<CS::ModifierKeyCode>& modifierKeys) noexcept;
+        
         /// Called by the gesture system when the player drags used to make the runner jump or slide
         /// depending on the direction of the drag.
         ///
@@ -81,10 +98,18 @@ namespace CSRunner
         
         /// Called by the collision system when the player collides with the obstacle and the given index
         ///
-        /// @param index
-        ///     Index of colliding obstacle in the generator system
+        /// @param handle
+        ///     Handle of colliding obstacle in the generator system
+        ///
+        void OnPlayerObstacleCollision(const ObstacleHandle& handle) noexcept;
+        
+        /// Creates a translucent, non-colliding player that replays the best run
+        ///
+        void CreateGhost() noexcept;
+        
+        /// Saves this run if it beats the best run
         ///
-        void OnPlayerObstacleCollision(u32 index) noexcept;
+        void SaveRecording() noexcept;
         
         ///
         void OnDestroy() noexcept override;
@@ -92,18 +117,21 @@ namespace CSRunner
     private:
         
         CS::GestureSystem* m_gestureSystem;
+        AnimationSystem* m_animationSystem;
         LevelGeneratorSystem* m_levelGenerator;
         CollisionSystem* m_collisionSystem;
         TransitionSystem* m_transitionSystem;
         PlayerController* m_playerController;
+        GhostRunUPtr m_bestRun;
+        GhostRunUPtr m_recording;
         CS::CkAudioPlayer* m_audioPlayer = nullptr;
-        CS::Keyboard* m_keyboard;
         
         CS::EventConnectionUPtr m_dragMovedEventConnection;
         CS::EventConnectionUPtr m_obstacleCollisionEventConnection;
         CS::EventConnectionUPtr m_gamepadAxisEventConnection;
+        CS::EventConnectionUPtr m_keyPressedEventConnection;
         
-        CS::TextUIComponent* m_timeSurvivedLabel = nullptr;
+        TextBinding m_timeSurvivedText;
         
         f32 m_timeSurvived = 0.0f;
         f32 m_minDragDistance = 0.0f;
@@ -24,6 +24,8 @@
 
 #include <States/GameoverState.h>
 
+#include <Common/TextBinding.h>
+#include <Common/TweenSystem.h>
 #include <Transition/TransitionSystem.h>
 #include <States/MainMenuState.h>
 
@@ -55,7 +57,8 @@ namespace CSRunner
     //------------------------------------------------------------
     void GameoverState::CreateSystems() noexcept
     {
-        m_transitionSystem = CreateSystem<TransitionSystem>(0.0f, 1.0f);
+        auto tweenSystem = CreateSystem<TweenSystem>();
+        m_transitionSystem = CreateSystem<TransitionSystem>(tweenSystem, 0.0f, 1.0f);
         m_gestureSystem = CreateSystem<CS::GestureSystem>();
     }
     
@@ -76,8 +79,8 @@ namespace CSRunner
             bestTimeSurvived = root.get(k_saveDataBestTimeKey, 0u).asUInt();
         }
         
-        auto timeSurvivedLabel = gameoverView->GetWidgetRecursive("LastTime")->GetComponent<CS::TextUIComponent>();
-        timeSurvivedLabel->SetText("You survived for " + CS::ToString(m_timeSurvived) + " seconds");
+        TextBinding timeSurvivedText(gameoverView->GetWidgetRecursive("LastTime")->GetComponent<CS::TextUIComponent>(), "You survived for ", " seconds");
+        timeSurvivedText.SetValue(m_timeSurvived);
         
         std::string bestTimePrefix;
         if(m_timeSurvived > bestTimeSurvived)
@@ -88,8 +91,8 @@ namespace CSRunner
             CS::JsonUtils::WriteJson(CS::StorageLocation::k_saveData, k_saveDataPath, root);
         }
         
-        auto bestTimeLabel = gameoverView->GetWidgetRecursive("BestTime")->GetComponent<CS::TextUIComponent>();
-        bestTimeLabel->SetText(bestTimePrefix + "Best time " + CS::ToString(bestTimeSurvived) + " seconds");
+        TextBinding bestTimeText(gameoverView->GetWidgetRecursive("BestTime")->GetComponent<CS::TextUIComponent>(), bestTimePrefix + "Best time ", " seconds");
+        bestTimeText.SetValue(bestTimeSurvived);
         
         auto tapGesture = std::make_shared<CS::TapGesture>();
         m_tapEventConnection = tapGesture->GetTappedEvent().OpenConnection([this](const CS::TapGesture* gesture, const CS::Vector2& pos)
@@ -24,6 +24,7 @@
 
 #include <States/MainMenuState.h>
 
+#include <Common/TweenSystem.h>
 #include <Transition/TransitionSystem.h>
 #include <States/GameState.h>
 
@@ -40,7 +41,8 @@ namespace CSRunner
     //------------------------------------------------------------
     void MainMenuState::CreateSystems() noexcept
     {
-        m_transitionSystem = CreateSystem<TransitionSystem>(1.0f, 1.0f);
+        auto tweenSystem = CreateSystem<TweenSystem>();
+        m_transitionSystem = CreateSystem<TransitionSystem>(tweenSystem, 1.0f, 1.0f);
     }
     
     //------------------------------------------------------------
@@ -0,0 +1,214 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <States/SimulationState.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Delegate.h>
+#include <ChilliSource/Core/String.h>
+
+#include <Animation/AnimationSystem.h>
+#include <Collision/CollisionSystem.h>
+#include <Environment/LevelGeneratorSystem.h>
+#include <Player/PlayerController.h>
+#include <Player/PlayerFactory.h>
+#include <Simulation/AllocationCounter.h>
+#include <GameConfig.h>
+
+#include <chrono>
+
+namespace CSRunner
+{
+    namespace
+    {
+        constexpr f32 k_stepInterval = 1.0f / 60.0f;
+        constexpr f64 k_frameBudgetSeconds = 1.0 / 30.0;
+        constexpr f32 k_maxSimulatedSeconds = 600.0f;
+        constexpr u32 k_numRuns = 10;
+        
+        constexpr f32 k_longStepInterval = 0.2f;
+        constexpr f32 k_maxLongStepSimulatedSeconds = 30.0f;
+    }
+    
+    //------------------------------------------------------------
+    SimulationState::SimulationState(u32 seed, u32 runIndex) noexcept
+    : m_seed(seed), m_runIndex(runIndex), m_isLongStepRun(runIndex == k_numRuns)
+    {
+        m_stepInterval = m_isLongStepRun == true ? k_longStepInterval : k_stepInterval;
+        m_maxSimulatedSeconds = m_isLongStepRun == true ? k_maxLongStepSimulatedSeconds : k_maxSimulatedSeconds;
+    }
+    
+    //------------------------------------------------------------
+    void SimulationState::CreateSystems() noexcept
+    {
+        m_animationSystem = CreateSystem<AnimationSystem>();
+        //Inline refills so that a spawn is never held up, however many steps are run per frame, and each seed
+        //lays out the same level as the RunSimulation
+        m_levelGenerator = CreateSystem<LevelGeneratorSystem>(m_animationSystem, m_seed, DifficultyConfig(), ObstacleSequencer::RefillMode::k_inline);
+        m_collisionSystem = CreateSystem<CollisionSystem>(m_levelGenerator);
+        
+        m_levelGenerator->SetManualStepping(true);
+        m_collisionSystem->SetManualStepping(true);
+    }
+    
+    //------------------------------------------------------------
+    void SimulationState::OnInit() noexcept
+    {
+        m_player = PlayerFactory::CreatePlayer(m_animationSystem, nullptr);
+        m_playerController = m_player->GetComponent<PlayerController>().get();
+        m_collisionSystem->SetPlayer(m_playerController);
+        
+        if(m_isLongStepRun == false)
+        {
+            m_autoPlayer = AutoPlayerUPtr(new AutoPlayer(m_levelGenerator, m_playerController));
+        }
+        
+        m_obstacleCollisionEventConnection = m_collisionSystem->GetPlayerObstacleCollisionEvent().OpenConnection(CS::MakeDelegate(this, &SimulationState::OnPlayerObstacleCollision));
+    }
+    
+    //------------------------------------------------------------
+    void SimulationState::OnUpdate(f32 timeSinceLastUpdate) noexcept
+    {
+        if(m_isFinished == true)
+        {
+            return;
+        }
+        
+        auto start = std::chrono::steady_clock::now();
+        f64 elapsed = 0.0;
+        while(m_isFinished == false && elapsed < k_frameBudgetSeconds)
+        {
+            Step();
+            elapsed = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+        }
+        m_wallSeconds += elapsed;
+        
+        if(m_isFinished == true)
+        {
+            FinishRun();
+        }
+    }
+    
+    //------------------------------------------------------------
+    void SimulationState::Step() noexcept
+    {
+        //Same order as the game: input, then the player, then the level, then collision
+        if(m_autoPlayer != nullptr)
+        {
+            m_autoPlayer->Update();
+        }
+        m_playerController->Step(m_stepInterval);
+        m_levelGenerator->Step(m_stepInterval);
+        
+        const auto& obstacles = m_levelGenerator->GetStream().GetObstacles();
+        if(m_hasFirstObstacle == false && obstacles.GetCount() > 0)
+        {
+            m_firstObstacle = obstacles.GetHandle(obstacles.GetAt(0));
+            m_hasFirstObstacle = true;
+        }
+        
+        //A hit runs the game's response, which may allocate, so only steps without one are checked
+        u32 numCollisions = m_numCollisions;
+        u64 numAllocations = AllocationCounter::GetThreadAllocationCount();
+        m_collisionSystem->Step(m_stepInterval);
+        if(m_numCollisions == numCollisions && AllocationCounter::GetThreadAllocationCount() != numAllocations)
+        {
+            ++m_numAllocatingCollisionSteps;
+        }
+        
+        m_simulatedSeconds += m_stepInterval;
+        if(m_simulatedSeconds >= m_maxSimulatedSeconds)
+        {
+            m_isFinished = true;
+        }
+    }
+    
+    //------------------------------------------------------------
+    void SimulationState::OnPlayerObstacleCollision(const ObstacleHandle& handle) noexcept
+    {
+        if(m_isFinished == true)
+        {
+            return;
+        }
+        
+        ++m_numCollisions;
+        m_playerController->Bump();
+        m_levelGenerator->DestroyObstacle(handle);
+        
+        //Without input the first obstacle must be the first hit, or a long step carried it past the player
+        if(m_isLongStepRun == true)
+        {
+            m_hitFirstObstacle = m_hasFirstObstacle == true && handle.m_slot == m_firstObstacle.m_slot && handle.m_generation == m_firstObstacle.m_generation;
+            m_isFinished = true;
+            return;
+        }
+        
+        //The game ends once the player has been bumped offscreen
+        if(m_player->GetTransform().GetLocalPosition().x <= GameConfig::k_cullX)
+        {
+            m_isFinished = true;
+        }
+    }
+    
+    //------------------------------------------------------------
+    void SimulationState::FinishRun() noexcept
+    {
+        if(m_isLongStepRun == true)
+        {
+            if(m_hitFirstObstacle == true)
+            {
+                CS_LOG_VERBOSE("Simulation long step run: the first obstacle was hit after " + CS::ToString(m_simulatedSeconds) + " s.");
+            }
+            else
+            {
+                CS_LOG_ERROR("Simulation long step run: the first obstacle was not hit with a " + CS::ToString(m_stepInterval) + " s step.");
+            }
+            
+            if(m_numAllocatingCollisionSteps > 0)
+            {
+                CS_LOG_ERROR("Simulation long step run: the collision pass allocated in " + CS::ToString(m_numAllocatingCollisionSteps) + " steps.");
+            }
+            
+            CS_LOG_VERBOSE("Simulation complete.");
+            return;
+        }
+        
+        f64 speed = m_wallSeconds > 0.0 ? f64(m_simulatedSeconds) / m_wallSeconds : 0.0;
+        CS_LOG_VERBOSE("Simulation run " + CS::ToString(m_runIndex + 1) + "/" + CS::ToString(k_numRuns) + " (seed " + CS::ToString(m_seed) + "): survived " + CS::ToString(m_simulatedSeconds) + " s, collisions: " + CS::ToString(m_numCollisions) + ", " + CS::ToString(f32(speed)) + " simulated s per wall s");
+        
+        if(m_numAllocatingCollisionSteps > 0)
+        {
+            CS_LOG_ERROR("Simulation run " + CS::ToString(m_runIndex + 1) + ": the collision pass allocated in " + CS::ToString(m_numAllocatingCollisionSteps) + " steps.");
+        }
+        
+        //The last auto played run is followed by the long step run
+        CS::Application::Get()->GetStateManager()->Change(std::make_shared<SimulationState>(m_seed + 1, m_runIndex + 1));
+    }
+    
+    //------------------------------------------------------------
+    void SimulationState::OnDestroy() noexcept
+    {
+        m_obstacleCollisionEventConnection.reset();
+    }
+}
@@ -0,0 +1,134 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_STATES_SIMULATIONSTATE_H_
+#define _APPSOURCE_STATES_SIMULATIONSTATE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/Entity.h>
+#include <ChilliSource/Core/Event.h>
+#include <ChilliSource/Core/State.h>
+
+#include <Environment/ObstacleRing.h>
+#include <Player/AutoPlayer.h>
+
+
+namespace CSRunner
+{
+    /// Headless run of the game used as the regression harness for the level generator and
+    /// collision. The real LevelGeneratorSystem, CollisionSystem and PlayerController are
+    /// stepped at a fixed interval as many times as fit in each frame, with the auto player
+    /// in place of input. There is no camera, UI or audio, so nothing is drawn or heard.
+    ///
+    /// Each run ends when the player is bumped offscreen or the simulated time limit is
+    /// reached, and logs the survival time, number of collisions and simulated seconds per
+    /// wall second. The collision pass must not allocate, so every step without a hit is
+    /// checked for heap allocations and any that allocated are reported as an error. The next
+    /// run then starts with the following seed until all runs are done.
+    ///
+    /// A final run steps at 200 ms, as a badly stalled frame would, with no input. The player
+    /// then stands in the path of the first obstacle spawned, and the run reports an error
+    /// unless that obstacle is the one hit.
+    ///
+    /// This is the initial state when CSRUNNER_HEADLESS_SIMULATION is defined.
+    ///
+    class SimulationState final : public CS::State
+    {
+    public:
+        
+        /// @param seed
+        ///     Level seed for this run
+        /// @param runIndex
+        ///     Index of this run within the batch. The index after the last auto played run
+        ///     is the long step run.
+        ///
+        SimulationState(u32 seed, u32 runIndex) noexcept;
+        
+    private:
+        
+        /// Creates the game systems and switches them to manual stepping
+        ///
+        void CreateSystems() noexcept override;
+        
+        /// Creates the player outside the scene, so that it is only advanced by the simulation
+        ///
+        void OnInit() noexcept override;
+        
+        /// Steps the simulation until the frame budget is spent
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since last update
+        ///
+        void OnUpdate(f32 timeSinceLastUpdate) noexcept override;
+        
+        /// Advances every part of the game by one fixed step
+        ///
+        void Step() noexcept;
+        
+        /// Applies the same response as the game: bump the player and destroy the obstacle
+        ///
+        /// @param handle
+        ///     Handle of hit obstacle
+        ///
+        void OnPlayerObstacleCollision(const ObstacleHandle& handle) noexcept;
+        
+        /// Logs the results and starts the next run, if any
+        ///
+        void FinishRun() noexcept;
+        
+        ///
+        void OnDestroy() noexcept override;
+        
+    private:
+        
+        u32 m_seed;
+        u32 m_runIndex;
+        bool m_isLongStepRun;
+        f32 m_stepInterval;
+        f32 m_maxSimulatedSeconds;
+        
+        AnimationSystem* m_animationSystem = nullptr;
+        LevelGeneratorSystem* m_levelGenerator = nullptr;
+        CollisionSystem* m_collisionSystem = nullptr;
+        
+        CS::EntityUPtr m_player;
+        PlayerController* m_playerController = nullptr;
+        AutoPlayerUPtr m_autoPlayer;
+        
+        CS::EventConnectionUPtr m_obstacleCollisionEventConnection;
+        
+        f32 m_simulatedSeconds = 0.0f;
+        f64 m_wallSeconds = 0.0;
+        u32 m_numCollisions = 0;
+        u32 m_numAllocatingCollisionSteps = 0;
+        bool m_isFinished = false;
+        
+        ObstacleHandle m_firstObstacle;
+        bool m_hasFirstObstacle = false;
+        bool m_hitFirstObstacle = false;
+    };
+}
+
+#endif
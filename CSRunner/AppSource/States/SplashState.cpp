@@ -24,6 +24,7 @@
 
 #include <States/SplashState.h>
 
+#include <Common/TweenSystem.h>
 #include <Transition/TransitionSystem.h>
 #include <States/MainMenuState.h>
 
@@ -46,7 +47,8 @@ namespace CSRunner
     //------------------------------------------------------------
     void SplashState::CreateSystems() noexcept
     {
-        m_transitionSystem = CreateSystem<TransitionSystem>(0.0f, 1.0f);
+        auto tweenSystem = CreateSystem<TweenSystem>();
+        m_transitionSystem = CreateSystem<TransitionSystem>(tweenSystem, 0.0f, 1.0f);
     }
     
     //------------------------------------------------------------
@@ -0,0 +1,227 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <States/SweepState.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Core/Threading.h>
+#include <ChilliSource/Core/Json/JsonUtils.h>
+#include <ChilliSource/Rendering/Texture.h>
+
+#include <Environment/ObstacleCatalogue.h>
+#include <Environment/ObstaclePatternLibrary.h>
+#include <Simulation/RunSimulation.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace CSRunner
+{
+    namespace
+    {
+        const f32 k_scrollSpeedScales[] = { 0.8f, 1.0f, 1.2f, 1.4f };
+        const f32 k_minDistanceScales[] = { 0.8f, 1.0f, 1.2f };
+        const f32 k_maxDistanceScales[] = { 0.75f, 1.0f };
+        const f32 k_lowObstacleProbabilities[] = { 1.0f, 2.0f, 3.0f };
+        
+        constexpr u32 k_runsPerConfiguration = 50;
+        constexpr u32 k_firstSeed = 1;
+        constexpr f32 k_stepInterval = 1.0f / 60.0f;
+        constexpr f32 k_maxSimulatedSeconds = 300.0f;
+        
+        const std::string k_resultsPath = "DifficultySweep.json";
+        
+        /// @param sorted
+        ///     Ascending values. Must not be empty.
+        /// @param fraction
+        ///     Percentile as a fraction
+        ///
+        /// @return Nearest rank percentile
+        ///
+        f32 GetPercentile(const std::vector<f32>& sorted, f32 fraction) noexcept
+        {
+            u32 index = std::min(u32(fraction * f32(sorted.size())), u32(sorted.size()) - 1);
+            return sorted[index];
+        }
+        
+        /// @return Seconds on a monotonic clock
+        ///
+        f64 GetClockSeconds() noexcept
+        {
+            return std::chrono::duration<f64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    }
+    
+    //------------------------------------------------------------
+    void SweepState::CreateSystems() noexcept
+    {
+        for(f32 scrollSpeedScale : k_scrollSpeedScales)
+        {
+            for(f32 minDistanceScale : k_minDistanceScales)
+            {
+                for(f32 maxDistanceScale : k_maxDistanceScales)
+                {
+                    for(f32 lowObstacleProbability : k_lowObstacleProbabilities)
+                    {
+                        Configuration configuration;
+                        configuration.m_config.m_scrollSpeed = GameConfig::k_scrollSpeed * scrollSpeedScale;
+                        configuration.m_config.m_minDistanceBetweenObstacles = GameConfig::k_minDistanceBetweenObstacles * minDistanceScale;
+                        configuration.m_config.m_maxDistanceBetweenObstacles = std::max(GameConfig::k_maxDistanceBetweenObstacles * maxDistanceScale, configuration.m_config.m_minDistanceBetweenObstacles);
+                        configuration.m_config.m_lowObstacleProbability = lowObstacleProbability;
+                        configuration.m_config.m_highObstacleProbability = 1.0f;
+                        m_configurations.push_back(configuration);
+                    }
+                }
+            }
+        }
+    }
+    
+    //------------------------------------------------------------
+    void SweepState::OnInit() noexcept
+    {
+        //Resources are loaded here on the main thread. The tasks only read the results.
+        auto resourcePool = CS::Application::Get()->GetResourcePool();
+        auto obstaclesAtlas = resourcePool->LoadResource<CS::TextureAtlas>(CS::StorageLocation::k_package, "TextureAtlases/Obstacles/Obstacles.csatlas");
+        m_catalogue = ObstacleCatalogueUPtr(new ObstacleCatalogue(obstaclesAtlas.get()));
+        m_patterns = resourcePool->LoadResource<ObstaclePatternLibrary>(CS::StorageLocation::k_package, "Patterns/Patterns.cspatterns");
+        
+        CS_LOG_VERBOSE("Difficulty sweep: " + CS::ToString(u32(m_configurations.size())) + " configurations, " + CS::ToString(k_runsPerConfiguration) + " runs each, on " + CS::ToString(u32(std::thread::hardware_concurrency())) + " cores.");
+        
+        m_cancelled = false;
+        m_tasksRemaining = u32(m_configurations.size());
+        m_startTime = GetClockSeconds();
+        
+        auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+        for(auto& configuration : m_configurations)
+        {
+            Configuration* target = &configuration;
+            //Each configuration runs for seconds, so it is a large task to keep the small task pool free for the engine
+            taskScheduler->ScheduleTask(CS::TaskType::k_large, [=](const CS::TaskContext&) noexcept
+            {
+                RunConfiguration(*target);
+                --m_tasksRemaining;
+            });
+        }
+    }
+    
+    //------------------------------------------------------------
+    void SweepState::OnUpdate(f32 timeSinceLastUpdate) noexcept
+    {
+        if(m_isReported == false && m_tasksRemaining == 0)
+        {
+            Report();
+            m_isReported = true;
+        }
+    }
+    
+    //------------------------------------------------------------
+    void SweepState::RunConfiguration(Configuration& configuration) noexcept
+    {
+        configuration.m_survivedSeconds.reserve(k_runsPerConfiguration);
+        
+        for(u32 i = 0; i < k_runsPerConfiguration && m_cancelled == false; ++i)
+        {
+            RunSimulation run(k_firstSeed + i, configuration.m_config, *m_catalogue, m_patterns);
+            run.Run(k_stepInterval, k_maxSimulatedSeconds);
+            
+            configuration.m_survivedSeconds.push_back(run.GetSurvivedSeconds());
+            configuration.m_numCollisions += run.GetNumCollisions();
+            if(run.IsGameOver() == false)
+            {
+                ++configuration.m_numTimeLimitReached;
+            }
+        }
+        
+        std::sort(configuration.m_survivedSeconds.begin(), configuration.m_survivedSeconds.end());
+    }
+    
+    //------------------------------------------------------------
+    void SweepState::Report() noexcept
+    {
+        CS_LOG_VERBOSE("Difficulty sweep finished in " + CS::ToString(f32(GetClockSeconds() - m_startTime)) + " s.");
+        CS_LOG_VERBOSE("scroll, minGap, maxGap, low:high -> survived min / p10 / p50 / p90 / max / mean s, collisions per run, reached time limit");
+        
+        Json::Value root(Json::arrayValue);
+        for(const auto& configuration : m_configurations)
+        {
+            const auto& survived = configuration.m_survivedSeconds;
+            if(survived.empty() == true)
+            {
+                continue;
+            }
+            
+            f32 total = 0.0f;
+            for(f32 seconds : survived)
+            {
+                total += seconds;
+            }
+            
+            f32 numRuns = f32(survived.size());
+            f32 mean = total / numRuns;
+            f32 collisionsPerRun = f32(configuration.m_numCollisions) / numRuns;
+            f32 timeLimitFraction = f32(configuration.m_numTimeLimitReached) / numRuns;
+            const auto& config = configuration.m_config;
+            
+            CS_LOG_VERBOSE(CS::ToString(config.m_scrollSpeed) + ", " + CS::ToString(config.m_minDistanceBetweenObstacles) + ", " + CS::ToString(config.m_maxDistanceBetweenObstacles) + ", " + CS::ToString(config.m_lowObstacleProbability) + ":" + CS::ToString(config.m_highObstacleProbability)
+                           + " -> " + CS::ToString(survived.front()) + " / " + CS::ToString(GetPercentile(survived, 0.1f)) + " / " + CS::ToString(GetPercentile(survived, 0.5f)) + " / " + CS::ToString(GetPercentile(survived, 0.9f)) + " / " + CS::ToString(survived.back()) + " / " + CS::ToString(mean)
+                           + ", " + CS::ToString(collisionsPerRun) + ", " + CS::ToString(timeLimitFraction * 100.0f) + "%");
+            
+            Json::Value entry(Json::objectValue);
+            entry["ScrollSpeed"] = config.m_scrollSpeed;
+            entry["MinDistanceBetweenObstacles"] = config.m_minDistanceBetweenObstacles;
+            entry["MaxDistanceBetweenObstacles"] = config.m_maxDistanceBetweenObstacles;
+            entry["LowObstacleProbability"] = config.m_lowObstacleProbability;
+            entry["HighObstacleProbability"] = config.m_highObstacleProbability;
+            entry["CollisionsPerRun"] = collisionsPerRun;
+            entry["TimeLimitReachedFraction"] = timeLimitFraction;
+            
+            Json::Value survivedSeconds(Json::arrayValue);
+            for(f32 seconds : survived)
+            {
+                survivedSeconds.append(seconds);
+            }
+            entry["SurvivedSeconds"] = survivedSeconds;
+            
+            root.append(entry);
+        }
+        
+        CS::JsonUtils::WriteJson(CS::StorageLocation::k_saveData, k_resultsPath, root);
+        CS_LOG_VERBOSE("Difficulty sweep results saved to " + k_resultsPath);
+    }
+    
+    //------------------------------------------------------------
+    void SweepState::OnDestroy() noexcept
+    {
+        m_cancelled = true;
+        while(m_tasksRemaining > 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
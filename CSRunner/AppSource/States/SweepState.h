@@ -0,0 +1,109 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _APPSOURCE_STATES_SWEEPSTATE_H_
+#define _APPSOURCE_STATES_SWEEPSTATE_H_
+
+#include <ForwardDeclarations.h>
+
+#include <ChilliSource/Core/State.h>
+
+#include <GameConfig.h>
+
+#include <atomic>
+#include <vector>
+
+namespace CSRunner
+{
+    /// Difficulty tuning sweep. Plays a batch of seeded auto player runs for every combination of a
+    /// grid of scroll speeds, obstacle spacings and obstacle type probabilities, and reports the
+    /// distribution of survival times for each.
+    ///
+    /// Each configuration is one background task, so the sweep is spread across every core. Runs use
+    /// the entity-free RunSimulation and each task writes only its own results, so nothing is shared
+    /// between tasks other than the read only catalogue and patterns. The same seeds are used for every
+    /// configuration so that the configurations are compared on the same levels.
+    ///
+    /// Results are logged and saved as JSON to DifficultySweep.json in save data.
+    ///
+    /// This is the initial state when CSRUNNER_DIFFICULTY_SWEEP is defined.
+    ///
+    class SweepState final : public CS::State
+    {
+    private:
+        
+        /// Settings and results for one configuration
+        ///
+        struct Configuration final
+        {
+            DifficultyConfig m_config;
+            std::vector<f32> m_survivedSeconds;
+            u32 m_numCollisions = 0;
+            u32 m_numTimeLimitReached = 0;
+        };
+        
+        /// Builds the grid of configurations
+        ///
+        void CreateSystems() noexcept override;
+        
+        /// Loads the obstacle data then schedules one task per configuration
+        ///
+        void OnInit() noexcept override;
+        
+        /// Reports once every task has finished
+        ///
+        /// @param timeSinceLastUpdate
+        ///     Time in seconds since last update
+        ///
+        void OnUpdate(f32 timeSinceLastUpdate) noexcept override;
+        
+        /// Plays every run for a configuration. Called on a background task.
+        ///
+        /// @param configuration
+        ///     Configuration to play and store the results in
+        ///
+        void RunConfiguration(Configuration& configuration) noexcept;
+        
+        /// Logs and saves the survival time distribution of each configuration
+        ///
+        void Report() noexcept;
+        
+        /// Stops any runs not yet started and waits for running tasks to finish
+        ///
+        void OnDestroy() noexcept override;
+        
+    private:
+        
+        ObstacleCatalogueUPtr m_catalogue;
+        ObstaclePatternLibraryCSPtr m_patterns;
+        
+        std::vector<Configuration> m_configurations;
+        std::atomic<u32> m_tasksRemaining{0};
+        std::atomic<bool> m_cancelled{false};
+        f64 m_startTime = 0.0;
+        bool m_isReported = false;
+    };
+}
+
+#endif
@@ -33,7 +33,8 @@
 
 #include <ChilliSource/Core/Event.h>
 #include <ChilliSource/Core/System.h>
-#include <ChilliSource/Core/Tween.h>
+
+#include <Common/TweenPool.h>
 
 #include <functional>
 
@@ -64,12 +65,13 @@ namespace CSRunner
         ///
         /// @author Ian Copland
         ///
+        /// @param The tween system that plays the fade.
         /// @param The time taken to fade in.
         /// @param The time taken to fade out.
         ///
         /// @return The new instance.
         //-------------------------------------------------
-        static TransitionSystemUPtr Create(f32 in_fadeInTime, f32 in_fadeOutTime);
+        static TransitionSystemUPtr Create(TweenSystem* in_tweenSystem, f32 in_fadeInTime, f32 in_fadeOutTime);
         //-------------------------------------------------
         /// Allows querying of whether or not this system
         /// implements the interface with the given Id.
@@ -134,10 +136,11 @@ namespace CSRunner
         ///
         /// @author Ian Copland
         ///
+        /// @param The tween system that plays the fade.
         /// @param The time taken to fade in.
         /// @param The time taken to fade out.
         //-------------------------------------------------
-        TransitionSystem(f32 in_fadeInTime, f32 in_fadeOutTime);
+        TransitionSystem(TweenSystem* in_tweenSystem, f32 in_fadeInTime, f32 in_fadeOutTime);
         //-------------------------------------------------
         /// Called when the state is initialised. This will
         /// start the fade in.
@@ -167,7 +170,8 @@ namespace CSRunner
         TransitionState m_transitionState;
         CS::StateSPtr m_targetState;
         CS::WidgetSPtr m_fadeImageView;
-        CS::SmoothStepTween<f32> m_fadeTween;
+        TweenSystem* m_tweenSystem;
+        TweenHandle<f32> m_fadeTween;
         CS::Event<TransitionDelegate> m_transitionInFinishedEvent;
         CS::Event<TransitionDelegate> m_transitionOutStartedEvent;
     };
@@ -0,0 +1,170 @@
+#!/usr/bin/python
+#
+#  animation_clip_builder.py
+#  CSRunner
+#
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2017 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#
+
+import argparse
+import json
+import os
+import struct
+import sys
+
+import file_system_utils
+
+CLIPS_FILE_NAME = "Clips.json"
+OUTPUT_EXTENSION = ".csclips"
+
+FILE_ID = 0x4C435343 # "CSCL"
+FILE_VERSION = 1
+
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+def build(input_directory_path, output_directory_path):
+    """
+    Walks the input texture atlas directory and converts each Clips.json into
+    a binary clip table alongside the atlas built from the same directory. This
+    must run after the atlases are built as the atlas builder clears its output.
+
+    :param input_directory_path: The input texture atlas directory path.
+    :param output_directory_path: The output texture atlas directory path.
+    """
+    print("-----------------------------------------")
+    print("        Building animation clips")
+    print("-----------------------------------------")
+
+    for current_input_directory_path, sub_input_directory_paths, file_names in os.walk(input_directory_path):
+        if CLIPS_FILE_NAME in file_names:
+            current_output_directory_path = os.path.join(output_directory_path, current_input_directory_path[len(input_directory_path):])
+            if os.path.exists(current_output_directory_path) == False:
+                os.makedirs(current_output_directory_path)
+
+            input_file_path = os.path.join(current_input_directory_path, CLIPS_FILE_NAME)
+            output_file_path = os.path.join(current_output_directory_path, os.path.basename(os.path.normpath(current_output_directory_path)) + OUTPUT_EXTENSION)
+            atlas_frame_ids = get_atlas_frame_ids(file_names)
+            build_clip_table(input_file_path, output_file_path, atlas_frame_ids)
+
+    print(" ")
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+def get_atlas_frame_ids(file_names):
+    """
+    :param file_names: The file names in an atlas source directory.
+
+    :returns: The set of frame ids the atlas will contain, i.e. the png file
+    names without tags or extension.
+    """
+    frame_ids = set()
+    for file_name in file_names:
+        if file_system_utils.has_extension(file_name, ".png") == True:
+            frame_ids.add(file_name[0 : file_name.find(".")])
+    return frame_ids
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+def build_clip_table(input_file_path, output_file_path, atlas_frame_ids):
+    """
+    Converts a single clip description to the binary clip table format. Every
+    distinct frame used by any clip is written once to a shared frame table and
+    clips store indices into it. All values are little endian and every section
+    is 4 byte aligned:
+
+        u32 file id, u32 version, u32 num frames, u32 num clips, u32 num keyframes
+        frames:    u32 string offset, u32 string length
+        clips:     u32 name offset, u32 name length, f32 frame rate, u32 first keyframe, u32 num keyframes
+        keyframes: u32 frame index
+        strings:   utf-8 bytes, offsets are relative to the start of this section
+
+    :param input_file_path: The Clips.json file path.
+    :param output_file_path: The output csclips file path.
+    :param atlas_frame_ids: The frame ids available in the atlas.
+    """
+    print(output_file_path)
+
+    with open(input_file_path, "r") as input_file:
+        description = json.load(input_file)
+
+    strings = bytearray()
+    def add_string(value):
+        encoded = value.encode("utf-8")
+        offset = len(strings)
+        strings.extend(encoded)
+        return (offset, len(encoded))
+
+    frames = []
+    frame_indices = {}
+    clips = []
+    keyframes = []
+
+    for clip_name in sorted(description["Clips"].keys()):
+        clip = description["Clips"][clip_name]
+        frame_ids = clip["Frames"]
+        if len(frame_ids) == 0:
+            sys.exit("Clip '" + clip_name + "' in " + input_file_path + " has no frames.")
+
+        first_keyframe = len(keyframes)
+        for frame_id in frame_ids:
+            if frame_id not in atlas_frame_ids:
+                sys.exit("Clip '" + clip_name + "' in " + input_file_path + " uses frame '" + frame_id + "' which is not in the atlas.")
+
+            if frame_id not in frame_indices:
+                frame_indices[frame_id] = len(frames)
+                frames.append(add_string(frame_id))
+            keyframes.append(frame_indices[frame_id])
+
+        name = add_string(clip_name)
+        clips.append((name[0], name[1], float(clip.get("FrameRate", 30.0)), first_keyframe, len(frame_ids)))
+
+    data = bytearray()
+    data.extend(struct.pack("<5I", FILE_ID, FILE_VERSION, len(frames), len(clips), len(keyframes)))
+    for frame in frames:
+        data.extend(struct.pack("<2I", frame[0], frame[1]))
+    for clip in clips:
+        data.extend(struct.pack("<2If2I", clip[0], clip[1], clip[2], clip[3], clip[4]))
+    for keyframe in keyframes:
+        data.extend(struct.pack("<I", keyframe))
+    data.extend(strings)
+
+    with open(output_file_path, "wb") as output_file:
+        output_file.write(data)
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+def parse_arguments():
+    """
+    Parses the given argument list.
+
+    :returns: A container for the parsed arguments.
+    """
+    script_desc = 'Converts the Clips.json animation descriptions in each texture atlas sub-directory of the input directory to csclips format and outputs them to the given output directory.'
+
+    parser = argparse.ArgumentParser(description=script_desc)
+    parser.add_argument('-i', '--input', dest='input_directory_path', type=str, required=True, help="The input directory containing the texture atlas sub directories.")
+    parser.add_argument('-o', '--output', dest='output_directory_path', type=str, required=True, help="The output directory where the output csclips files should be saved.")
+
+    return parser.parse_args()
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+if __name__ == "__main__":
+    args = parse_arguments();
+    build(args.input_directory_path, args.output_directory_path)
@@ -31,8 +31,10 @@ import argparse
 import os
 import sys
 
+import animation_clip_builder
 import model_builder
 import music_builder
+import obstacle_pattern_builder
 import sfx_builder
 import text_builder
 import texture_atlas_builder
@@ -40,9 +42,11 @@ import texture_builder
 
 MODEL_DIRECTORY_PATH = "Models/"
 MUSIC_DIRECTORY_PATH = "Music/"
+PATTERN_DIRECTORY_PATH = "Patterns/"
 SFX_DIRECTORY_PATH = "SFX/"
 TEXT_DIRECTORY_PATH = "Text/"
 TEXTURE_ATLAS_DIRECTORY_PATH = "TextureAtlases/"
+OBSTACLE_ATLAS_DIRECTORY_NAME = "Obstacles/"
 TEXTURE_DIRECTORY_PATH = "Textures/"
 
 #------------------------------------------------------------------------------ 
@@ -59,6 +63,8 @@ def build(input_directory_path, output_directory_path):
     model_builder.build(os.path.join(input_directory_path, MODEL_DIRECTORY_PATH), os.path.join(output_directory_path, MODEL_DIRECTORY_PATH))
     texture_builder.build(os.path.join(input_directory_path, TEXTURE_DIRECTORY_PATH), os.path.join(output_directory_path, TEXTURE_DIRECTORY_PATH))
     texture_atlas_builder.build(os.path.join(input_directory_path, TEXTURE_ATLAS_DIRECTORY_PATH), os.path.join(output_directory_path, TEXTURE_ATLAS_DIRECTORY_PATH))
+    animation_clip_builder.build(os.path.join(input_directory_path, TEXTURE_ATLAS_DIRECTORY_PATH), os.path.join(output_directory_path, TEXTURE_ATLAS_DIRECTORY_PATH))
+    obstacle_pattern_builder.build(os.path.join(input_directory_path, PATTERN_DIRECTORY_PATH), os.path.join(output_directory_path, PATTERN_DIRECTORY_PATH), os.path.join(input_directory_path, TEXTURE_ATLAS_DIRECTORY_PATH, OBSTACLE_ATLAS_DIRECTORY_NAME))
     music_builder.build(os.path.join(input_directory_path, MUSIC_DIRECTORY_PATH), os.path.join(output_directory_path, MUSIC_DIRECTORY_PATH))
     sfx_builder.build(os.path.join(input_directory_path, SFX_DIRECTORY_PATH), os.path.join(output_directory_path, SFX_DIRECTORY_PATH))
     text_builder.build(os.path.join(input_directory_path, TEXT_DIRECTORY_PATH), os.path.join(output_directory_path, TEXT_DIRECTORY_PATH))
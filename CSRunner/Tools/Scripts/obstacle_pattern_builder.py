@@ -0,0 +1,169 @@
+#!/usr/bin/python
+#
+#  obstacle_pattern_builder.py
+#  CSRunner
+#
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2017 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#
+
+import argparse
+import json
+import argparse
+import json
+import os
+import struct
+import sys
+
+import file_system_utils
+
+INPUT_EXTENSION = ".json"
+OUTPUT_EXTENSION = ".cspatterns"
+
+FILE_ID = 0x54505343 # "CSPT"
+FILE_VERSION = 1
+
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+def build(input_directory_path, output_directory_path, obstacle_atlas_directory_path):
+    """
+    Converts each pattern description json file in the input directory to the
+    binary pattern library format.
+
+    :param input_directory_path: The input pattern directory path.
+    :param output_directory_path: The output pattern directory path.
+    :param obstacle_atlas_directory_path: The obstacle texture atlas source
+    directory, used to check the obstacle names.
+    """
+    print("-----------------------------------------")
+    print("        Building obstacle patterns")
+    print("-----------------------------------------")
+
+    if os.path.exists(input_directory_path) == False:
+        print(" ")
+        return
+
+    obstacle_ids = set()
+    for file_name in os.listdir(obstacle_atlas_directory_path):
+        if file_system_utils.has_extension(file_name, ".png") == True:
+            obstacle_ids.add(file_name[0 : file_name.find(".")])
+
+    if os.path.exists(output_directory_path) == False:
+        os.makedirs(output_directory_path)
+
+    for file_name in sorted(os.listdir(input_directory_path)):
+        if file_system_utils.has_extension(file_name, INPUT_EXTENSION) == True:
+            input_file_path = os.path.join(input_directory_path, file_name)
+            output_file_path = os.path.join(output_directory_path, file_name[0 : file_name.rfind(".")] + OUTPUT_EXTENSION)
+            build_pattern_library(input_file_path, output_file_path, obstacle_ids)
+
+    print(" ")
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+def build_pattern_library(input_file_path, output_file_path, obstacle_ids):
+    """
+    Converts a single pattern description to the binary pattern library
+    format. Patterns are grouped by difficulty, and each distinct obstacle name
+    is written once with entries storing indices into the name table. All
+    values are little endian and every section is 4 byte aligned:
+
+        u32 file id, u32 version, u32 num names, u32 num difficulties, u32 num patterns, u32 num entries
+        names:        u32 string offset, u32 string length
+        difficulties: u32 first pattern, u32 num patterns
+        patterns:     u32 first entry, u32 num entries
+        entries:      u32 name index, f32 gap
+        strings:      utf-8 bytes, offsets are relative to the start of this section
+
+    :param input_file_path: The pattern json file path.
+    :param output_file_path: The output cspatterns file path.
+    :param obstacle_ids: The obstacle ids available in the obstacle atlas.
+    """
+    print(output_file_path)
+
+    with open(input_file_path, "r") as input_file:
+        description = json.load(input_file)
+
+    strings = bytearray()
+    names = []
+    name_indices = {}
+    difficulties = []
+    patterns = []
+    entries = []
+
+    for difficulty_index, difficulty in enumerate(description["Difficulties"]):
+        first_pattern = len(patterns)
+        for pattern in difficulty["Patterns"]:
+            obstacles = pattern["Obstacles"]
+            if len(obstacles) == 0:
+                sys.exit("A pattern at difficulty " + str(difficulty_index) + " in " + input_file_path + " has no obstacles.")
+
+            first_entry = len(entries)
+            for obstacle in obstacles:
+                obstacle_id = obstacle["Obstacle"]
+                if obstacle_id not in obstacle_ids:
+                    sys.exit("A pattern at difficulty " + str(difficulty_index) + " in " + input_file_path + " uses obstacle '" + obstacle_id + "' which is not in the obstacle atlas.")
+
+                if obstacle_id not in name_indices:
+                    encoded = obstacle_id.encode("utf-8")
+                    name_indices[obstacle_id] = len(names)
+                    names.append((len(strings), len(encoded)))
+                    strings.extend(encoded)
+                entries.append((name_indices[obstacle_id], float(obstacle["Gap"])))
+
+            patterns.append((first_entry, len(obstacles)))
+        difficulties.append((first_pattern, len(patterns) - first_pattern))
+
+    data = bytearray()
+    data.extend(struct.pack("<6I", FILE_ID, FILE_VERSION, len(names), len(difficulties), len(patterns), len(entries)))
+    for name in names:
+        data.extend(struct.pack("<2I", name[0], name[1]))
+    for difficulty in difficulties:
+        data.extend(struct.pack("<2I", difficulty[0], difficulty[1]))
+    for pattern in patterns:
+        data.extend(struct.pack("<2I", pattern[0], pattern[1]))
+    for entry in entries:
+        data.extend(struct.pack("<If", entry[0], entry[1]))
+    data.extend(strings)
+
+    with open(output_file_path, "wb") as output_file:
+        output_file.write(data)
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+def parse_arguments():
+    """
+    Parses the given argument list.
+
+    :returns: A container for the parsed arguments.
+    """
+    script_desc = 'Converts the obstacle pattern descriptions in the input directory to cspatterns format and outputs them to the given output directory.'
+
+    parser = argparse.ArgumentParser(description=script_desc)
+    parser.add_argument('-i', '--input', dest='input_directory_path', type=str, required=True, help="The input directory containing the pattern json files.")
+    parser.add_argument('-o', '--output', dest='output_directory_path', type=str, required=True, help="The output directory where the output cspatterns files should be saved.")
+    parser.add_argument('-a', '--atlas', dest='obstacle_atlas_directory_path', type=str, required=True, help="The obstacle texture atlas source directory.")
+
+    return parser.parse_args()
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+if __name__ == "__main__":
+    args = parse_arguments();
+    build(args.input_directory_path, args.output_directory_path, args.obstacle_atlas_directory_path)